@@ -0,0 +1,307 @@
+/**
+ * Allocation tracking shared by the examples and src/benchmark.hpp.
+ *
+ * Two ways to observe allocations:
+ *   - Global: this header replaces operator new/delete and counts every
+ *     heap allocation. alloc::Scope measures what the calling thread
+ *     allocates during its lifetime: count, bytes, and peak live bytes.
+ *     alloc::Report does the same and prints a summary line on exit.
+ *   - Per container: alloc::CountingResource is a std::pmr::memory_resource
+ *     that counts what passes through it on the way to an upstream resource.
+ *
+ * Usage:
+ *   {
+ *       alloc::Report report("findUser chain");
+ *       auto email = db.getUserEmail(1);
+ *   }  // prints "  findUser chain: 2 allocations, 64 bytes, peak 64 bytes"
+ *
+ * Because it defines the replacement operator new/delete, include this
+ * header from exactly one translation unit per program (each example is a
+ * single file).
+ */
+
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <cstring>
+#include <functional>
+#include <memory_resource>
+#include <mutex>
+#include <new>
+#include <print>
+#include <string_view>
+#include <unordered_map>
+#include <utility>
+
+namespace alloc {
+
+namespace detail {
+
+// Per-thread counters. Trivially constructible, so operator new can use
+// them at any time, including during static initialization.
+struct ThreadCounters {
+    std::uint64_t count;
+    std::uint64_t bytes;
+    std::int64_t live;   // Allocated minus freed on this thread
+    std::int64_t peak;   // Highest `live` since the innermost Scope began
+};
+
+inline constinit thread_local ThreadCounters thread_counters{};
+
+inline std::atomic<std::uint64_t> total_count{0};
+inline std::atomic<std::uint64_t> total_bytes{0};
+
+// Default-aligned blocks start with a header holding their size, so
+// operator delete can keep the live-byte count exact even when it is not
+// given the size
+inline constexpr std::size_t header_size = alignof(std::max_align_t);
+
+// Allocator for the bookkeeping below, which must not recurse into the
+// replaced operator new
+template<typename T>
+struct MallocAllocator {
+    using value_type = T;
+
+    MallocAllocator() = default;
+    template<typename U>
+    MallocAllocator(const MallocAllocator<U>&) noexcept {}
+
+    T* allocate(std::size_t n) {
+        if (void* p = std::malloc(n * sizeof(T))) return static_cast<T*>(p);
+        throw std::bad_alloc();
+    }
+    void deallocate(T* p, std::size_t) noexcept { std::free(p); }
+
+    friend bool operator==(MallocAllocator, MallocAllocator) { return true; }
+};
+
+// Over-aligned blocks (e.g. 4 KiB-aligned pool buffers) would need a whole
+// alignment unit in front for a header, so their sizes live in a side table
+// instead. Such allocations are rare, so one lock is enough.
+struct AlignedSizes {
+    std::mutex mutex;
+    std::unordered_map<void*, std::size_t, std::hash<void*>, std::equal_to<>,
+                       MallocAllocator<std::pair<void* const, std::size_t>>> sizes;
+};
+
+inline AlignedSizes& alignedSizes() {
+    // Never destroyed: blocks may still be freed during static destruction
+    static AlignedSizes* table = new (std::malloc(sizeof(AlignedSizes))) AlignedSizes();
+    return *table;
+}
+
+inline void countAllocation(std::size_t size) {
+    auto& counters = thread_counters;
+    ++counters.count;
+    counters.bytes += size;
+    counters.live += static_cast<std::int64_t>(size);
+    counters.peak = std::max(counters.peak, counters.live);
+
+    total_count.fetch_add(1, std::memory_order_relaxed);
+    total_bytes.fetch_add(size, std::memory_order_relaxed);
+}
+
+inline void freeAligned(void* block) noexcept {
+#if defined(_MSC_VER)
+    _aligned_free(block);
+#else
+    std::free(block);
+#endif
+}
+
+inline void* allocate(std::size_t size, std::size_t alignment = header_size) {
+    if (alignment <= header_size) {
+        void* base = std::malloc(header_size + size);
+        if (!base) throw std::bad_alloc();
+
+        auto* block = static_cast<std::byte*>(base) + header_size;
+        std::memcpy(block - sizeof(std::size_t), &size, sizeof(std::size_t));
+        countAllocation(size);
+        return block;
+    }
+
+    std::size_t rounded = (std::max<std::size_t>(size, 1) + alignment - 1) / alignment * alignment;
+#if defined(_MSC_VER)
+    void* block = _aligned_malloc(rounded, alignment);
+#else
+    // aligned_alloc requires the size to be a multiple of the alignment
+    void* block = std::aligned_alloc(alignment, rounded);
+#endif
+    if (!block) throw std::bad_alloc();
+    try {
+        auto& table = alignedSizes();
+        std::lock_guard lock(table.mutex);
+        table.sizes.emplace(block, size);
+    } catch (...) {
+        freeAligned(block);
+        throw;
+    }
+    countAllocation(size);
+    return block;
+}
+
+inline void deallocate(void* p, std::size_t alignment = header_size) noexcept {
+    if (!p) return;
+
+    if (alignment <= header_size) {
+        auto* block = static_cast<std::byte*>(p);
+        std::size_t size;
+        std::memcpy(&size, block - sizeof(std::size_t), sizeof(std::size_t));
+        thread_counters.live -= static_cast<std::int64_t>(size);
+        std::free(block - header_size);
+        return;
+    }
+
+    {
+        auto& table = alignedSizes();
+        std::lock_guard lock(table.mutex);
+        if (auto it = table.sizes.find(p); it != table.sizes.end()) {
+            thread_counters.live -= static_cast<std::int64_t>(it->second);
+            table.sizes.erase(it);
+        }
+    }
+    freeAligned(p);
+}
+
+} // namespace detail
+
+// Process-wide totals since program start, across all threads.
+// Subtract two snapshots to measure a region.
+struct Counters {
+    std::uint64_t count = 0;
+    std::uint64_t bytes = 0;
+
+    friend Counters operator-(Counters a, Counters b) {
+        return {a.count - b.count, a.bytes - b.bytes};
+    }
+};
+
+inline Counters totals() {
+    return {detail::total_count.load(std::memory_order_relaxed),
+            detail::total_bytes.load(std::memory_order_relaxed)};
+}
+
+struct Stats {
+    std::uint64_t count = 0;       // Allocations made
+    std::uint64_t bytes = 0;       // Bytes requested by them
+    std::int64_t peak_bytes = 0;   // Highest live-byte level above the starting point
+    std::int64_t net_bytes = 0;    // Still live at the end (negative: freed older blocks)
+};
+
+// Measures the current thread's allocations from construction until
+// stats() is called. Scopes nest; each reports its own peak. Must be
+// destroyed on the thread that created it.
+class Scope {
+    detail::ThreadCounters start_;
+    std::int64_t outer_peak_;
+
+public:
+    Scope() : start_(detail::thread_counters), outer_peak_(start_.peak) {
+        detail::thread_counters.peak = start_.live;
+    }
+
+    ~Scope() {
+        auto& counters = detail::thread_counters;
+        counters.peak = std::max(outer_peak_, counters.peak);
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+
+    Stats stats() const {
+        const auto& counters = detail::thread_counters;
+        return {counters.count - start_.count,
+                counters.bytes - start_.bytes,
+                counters.peak - start_.live,
+                counters.live - start_.live};
+    }
+};
+
+// Scope that prints its stats when it goes out of scope
+class Report {
+    std::string_view label_;
+    Scope scope_;
+
+public:
+    explicit Report(std::string_view label) : label_(label) {}
+
+    ~Report() {
+        auto stats = scope_.stats();
+        std::println("  {}: {} allocations, {} bytes, peak {} bytes",
+                     label_, stats.count, stats.bytes, stats.peak_bytes);
+    }
+
+    Report(const Report&) = delete;
+    Report& operator=(const Report&) = delete;
+};
+
+// Counts the traffic from pmr containers to an upstream resource, e.g.
+// how often a monotonic_buffer_resource had to grow. Like the standard
+// pool resources, it is not thread-safe.
+class CountingResource : public std::pmr::memory_resource {
+    std::pmr::memory_resource* upstream_;
+    std::uint64_t count_ = 0;
+    std::uint64_t bytes_ = 0;
+    std::int64_t live_ = 0;
+    std::int64_t peak_ = 0;
+
+    void* do_allocate(std::size_t bytes, std::size_t alignment) override {
+        void* p = upstream_->allocate(bytes, alignment);
+        ++count_;
+        bytes_ += bytes;
+        live_ += static_cast<std::int64_t>(bytes);
+        peak_ = std::max(peak_, live_);
+        return p;
+    }
+
+    void do_deallocate(void* p, std::size_t bytes, std::size_t alignment) override {
+        upstream_->deallocate(p, bytes, alignment);
+        live_ -= static_cast<std::int64_t>(bytes);
+    }
+
+    bool do_is_equal(const std::pmr::memory_resource& other) const noexcept override {
+        return this == &other;
+    }
+
+public:
+    explicit CountingResource(std::pmr::memory_resource* upstream = std::pmr::get_default_resource())
+        : upstream_(upstream) {}
+
+    Stats stats() const { return {count_, bytes_, peak_, live_}; }
+};
+
+} // namespace alloc
+
+// ============================================================================
+// Replacement global allocation functions
+// ============================================================================
+// Only the single-object forms are replaced: the default array and nothrow
+// forms are specified to call these.
+
+void* operator new(std::size_t size) {
+    return alloc::detail::allocate(size);
+}
+
+void* operator new(std::size_t size, std::align_val_t alignment) {
+    return alloc::detail::allocate(size, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p) noexcept {
+    alloc::detail::deallocate(p);
+}
+
+void operator delete(void* p, std::size_t) noexcept {
+    alloc::detail::deallocate(p);
+}
+
+void operator delete(void* p, std::align_val_t alignment) noexcept {
+    alloc::detail::deallocate(p, static_cast<std::size_t>(alignment));
+}
+
+void operator delete(void* p, std::size_t, std::align_val_t alignment) noexcept {
+    alloc::detail::deallocate(p, static_cast<std::size_t>(alignment));
+}
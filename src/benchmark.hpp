@@ -0,0 +1,168 @@
+/**
+ * Shared micro-benchmark harness for the examples' performance sections.
+ *
+ * Usage:
+ *   bench::Suite suite("example2.pipelines");
+ *   suite.run("cpp11 loops", products.size(), [&] { return process(products); });
+ *   suite.report();
+ *
+ * Each case is repeated until it has run for at least BENCH_MIN_TIME_MS
+ * milliseconds (default 20). report() prints a table of ns/op, ns/item,
+ * allocations/op, bytes/op and the peak live bytes of a single op, and
+ * when BENCH_JSON names a file it appends one JSON object per case to it
+ * (JSON Lines), so runs can be diffed or tracked over time.
+ *
+ * Allocations are counted by src/alloc_tracking.hpp, which replaces the
+ * global operator new/delete: include this header from exactly one
+ * translation unit per program (each example is a single file). Build with
+ * optimizations (-O2) for meaningful numbers.
+ */
+
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <functional>
+#include <print>
+#include <span>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+#include "alloc_tracking.hpp"
+
+namespace bench {
+
+// Keep `value`, and the work that produced it, from being optimized away
+template<typename T>
+inline void doNotOptimize(const T& value) {
+#if defined(__GNUC__) || defined(__clang__)
+    asm volatile("" : : "r,m"(value) : "memory");
+#else
+    static const volatile void* sink;
+    sink = &value;
+#endif
+}
+
+struct Result {
+    std::string suite;
+    std::string name;
+    std::size_t size = 0;          // Items processed per operation
+    std::uint64_t iterations = 0;
+    double ns_per_op = 0.0;
+    double allocs_per_op = 0.0;
+    double bytes_per_op = 0.0;
+    std::int64_t peak_bytes = 0;   // Peak live bytes during a single op
+
+    double nsPerItem() const { return size ? ns_per_op / static_cast<double>(size) : ns_per_op; }
+};
+
+namespace detail {
+
+inline std::chrono::nanoseconds minTimeFromEnv() {
+    if (const char* value = std::getenv("BENCH_MIN_TIME_MS")) {
+        if (long ms = std::strtol(value, nullptr, 10); ms > 0) {
+            return std::chrono::milliseconds(ms);
+        }
+    }
+    return std::chrono::milliseconds(20);
+}
+
+inline std::string jsonEscape(std::string_view s) {
+    std::string out;
+    out.reserve(s.size());
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+} // namespace detail
+
+class Suite {
+    std::string name_;
+    std::chrono::nanoseconds min_time_;
+    std::vector<Result> results_;
+
+    template<typename Fn>
+    static void invokeOnce(Fn& fn) {
+        if constexpr (std::is_void_v<std::invoke_result_t<Fn&>>) {
+            std::invoke(fn);
+        } else {
+            doNotOptimize(std::invoke(fn));
+        }
+    }
+
+public:
+    explicit Suite(std::string name)
+        : name_(std::move(name)), min_time_(detail::minTimeFromEnv()) {}
+
+    // Time fn(), which processes `size` items per call. The iteration count
+    // doubles until one timed batch lasts at least the minimum time.
+    template<typename Fn>
+    const Result& run(std::string_view name, std::size_t size, Fn&& fn) {
+        using clock = std::chrono::steady_clock;
+
+        // Warm caches and lazily-initialized state; measure one op's peak
+        std::int64_t peak_bytes;
+        {
+            alloc::Scope scope;
+            invokeOnce(fn);
+            peak_bytes = scope.stats().peak_bytes;
+        }
+
+        std::uint64_t iterations = 1;
+        while (true) {
+            auto allocations_before = alloc::totals();
+            auto start = clock::now();
+            for (std::uint64_t i = 0; i < iterations; ++i) invokeOnce(fn);
+            auto elapsed = clock::now() - start;
+            auto allocations = alloc::totals() - allocations_before;
+
+            if (elapsed >= min_time_ || iterations >= (std::uint64_t{1} << 40)) {
+                auto n = static_cast<double>(iterations);
+                results_.push_back({
+                    name_, std::string(name), size, iterations,
+                    static_cast<double>(std::chrono::nanoseconds(elapsed).count()) / n,
+                    static_cast<double>(allocations.count) / n,
+                    static_cast<double>(allocations.bytes) / n,
+                    peak_bytes});
+                return results_.back();
+            }
+            iterations *= 2;
+        }
+    }
+
+    std::span<const Result> results() const { return results_; }
+
+    void report() const {
+        std::println("{:<42} {:>9} {:>13} {:>10} {:>10} {:>12} {:>12}",
+                     name_, "size", "ns/op", "ns/item", "allocs/op", "bytes/op", "peak bytes");
+        for (const auto& r : results_) {
+            std::println("  {:<40} {:>9} {:>13.1f} {:>10.2f} {:>10.1f} {:>12.0f} {:>12}",
+                         r.name, r.size, r.ns_per_op, r.nsPerItem(),
+                         r.allocs_per_op, r.bytes_per_op, r.peak_bytes);
+        }
+
+        if (const char* path = std::getenv("BENCH_JSON")) {
+            std::ofstream out(path, std::ios::app);
+            for (const auto& r : results_) {
+                out << std::format(
+                    "{{\"suite\":\"{}\",\"name\":\"{}\",\"size\":{},\"iterations\":{},"
+                    "\"ns_per_op\":{:.3f},\"allocs_per_op\":{:.3f},\"bytes_per_op\":{:.1f},"
+                    "\"peak_bytes\":{}}}\n",
+                    detail::jsonEscape(r.suite), detail::jsonEscape(r.name), r.size,
+                    r.iterations, r.ns_per_op, r.allocs_per_op, r.bytes_per_op, r.peak_bytes);
+            }
+        }
+    }
+};
+
+} // namespace bench
@@ -11,6 +11,25 @@
 #include <optional>     // C++17
 #include <expected>     // C++23
 #include <print>        // C++23
+#include <vector>
+#include <array>
+#include <string_view>  // C++17
+#include <functional>
+#include <cstdint>
+#include <limits>
+#include <utility>
+#include <chrono>
+#include <span>         // C++20
+#include <algorithm>
+#include <atomic>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <thread>
+#include <latch>        // C++20
+
+#include "benchmark.hpp"
+#include "trace.hpp"
 
 // ============================================================================
 // C++11 Style: Error codes and output parameters
@@ -203,17 +222,33 @@ enum class UserError {
     InvalidId,
     NotFound,
     DatabaseError,
-    PermissionDenied
+    PermissionDenied,
+    AlreadyExists  // Keep last: error_messages is checked against it
 };
 
+// Indexed by UserError. The literals have static storage, so handing out
+// views of them never allocates.
+inline constexpr auto error_messages = std::to_array<std::string_view>({
+    "Invalid user ID",
+    "User not found",
+    "Database error",
+    "Permission denied",
+    "User already exists"
+});
+
+constexpr std::string_view errorMessageView(UserError error) {
+    auto index = static_cast<std::size_t>(std::to_underlying(error));
+    return index < error_messages.size() ? error_messages[index] : "Unknown error";
+}
+
+// Catches the table drifting out of sync with the enum at compile time
+static_assert(errorMessageView(UserError::InvalidId) == "Invalid user ID");
+static_assert(errorMessageView(UserError::AlreadyExists) == "User already exists");
+static_assert(error_messages.size() == std::to_underlying(UserError::AlreadyExists) + 1,
+              "Every UserError needs exactly one message");
+
 std::string errorMessage(UserError error) {
-    switch (error) {
-        case UserError::InvalidId: return "Invalid user ID";
-        case UserError::NotFound: return "User not found";
-        case UserError::DatabaseError: return "Database error";
-        case UserError::PermissionDenied: return "Permission denied";
-    }
-    return "Unknown error";
+    return std::string(errorMessageView(error));
 }
 
 class UserDatabase {
@@ -228,6 +263,8 @@ public:
 
     // C++23: std::expected contains either value OR error
     std::expected<User, UserError> findUser(int id) const {
+        TRACE_SCOPE("cpp23 findUser");
+
         if (id <= 0) {
             return std::unexpected(UserError::InvalidId);
         }
@@ -240,6 +277,32 @@ public:
         return it->second;
     }
 
+    // Zero-copy variant: refers to the stored User instead of copying it.
+    // The reference stays valid until the database is modified.
+    std::expected<std::reference_wrapper<const User>, UserError> findUserRef(int id) const {
+        if (id <= 0) {
+            return std::unexpected(UserError::InvalidId);
+        }
+
+        auto it = users_.find(id);
+        if (it == users_.end()) {
+            return std::unexpected(UserError::NotFound);
+        }
+
+        return std::cref(it->second);
+    }
+
+    // The whole chain runs on views, so a read-only lookup never allocates
+    std::expected<std::string_view, UserError> getUserEmailView(int id) const {
+        return findUserRef(id)
+            .and_then([](const User& user) -> std::expected<std::string_view, UserError> {
+                if (user.email.empty()) {
+                    return std::unexpected(UserError::DatabaseError);
+                }
+                return user.email;
+            });
+    }
+
     // Chaining operations with and_then
     std::expected<std::string, UserError> getUserEmail(int id) const {
         return findUser(id)
@@ -268,6 +331,14 @@ public:
                 return std::unexpected(errorMessage(error));
             });
     }
+
+    // Same, but the error path allocates nothing
+    std::expected<User, std::string_view> findUserWithMessageView(int id) const {
+        return findUser(id)
+            .or_else([](UserError error) -> std::expected<User, std::string_view> {
+                return std::unexpected(errorMessageView(error));
+            });
+    }
 };
 
 void demo() {
@@ -311,6 +382,15 @@ void demo() {
         std::println("Uppercase name: {}", name.value_or("ERROR"));
     }
 
+    // Zero-copy lookup: reference to the stored user, view of its email
+    {
+        if (auto user = db.findUserRef(1)) {
+            const User& alice = *user;
+            std::println("By reference: {} (no copy)", alice.name);
+        }
+        std::println("Email view: {}", db.getUserEmailView(3).value_or("none"));
+    }
+
     // Error transformation
     {
         auto result = db.findUserWithMessage(-5);
@@ -319,6 +399,14 @@ void demo() {
         }
     }
 
+    // Allocation-free error path: messages are views into a constexpr table
+    {
+        auto result = db.findUserWithMessageView(999);
+        if (!result) {
+            std::println("Error message (view): {}", result.error());
+        }
+    }
+
     // Advantages over C++17:
     // - Explicit error information (not just "no value")
     // - Type-safe error handling
@@ -332,6 +420,908 @@ void demo() {
 
 } // namespace cpp23_style
 
+// ============================================================================
+// Indexed Style: Contiguous storage with open-addressing indexes
+// ============================================================================
+
+namespace indexed_style {
+
+using cpp23_style::User;
+using cpp23_style::UserError;
+using cpp23_style::errorMessage;
+using cpp23_style::errorMessageView;
+
+// Hint the CPU to start loading a cache line we will need shortly
+inline void prefetch(const void* address) {
+#if defined(__GNUC__) || defined(__clang__)
+    __builtin_prefetch(address);
+#else
+    (void)address;
+#endif
+}
+
+// Open-addressing (linear probing) table mapping a key hash to a row in a
+// contiguous array. Keys are compared through a callback against the row
+// itself, so the same table serves both the id and the email index.
+class FlatIndex {
+    static constexpr std::uint32_t empty = std::numeric_limits<std::uint32_t>::max();
+
+    struct Slot {
+        std::uint64_t hash = 0;
+        std::uint32_t row = empty;
+    };
+
+    std::vector<Slot> slots_;
+    std::size_t size_ = 0;
+
+    std::size_t mask() const { return slots_.size() - 1; }
+
+    // Index of the slot holding exactly (hash, row)
+    std::size_t slotOf(std::uint64_t hash, std::uint32_t row) const {
+        std::size_t i = hash & mask();
+        while (slots_[i].row != row) {
+            i = (i + 1) & mask();
+        }
+        return i;
+    }
+
+    void rehash(std::size_t capacity) {
+        std::vector<Slot> old = std::exchange(slots_, std::vector<Slot>(capacity));
+        for (const Slot& slot : old) {
+            if (slot.row != empty) place(slot);
+        }
+    }
+
+    void place(Slot slot) {
+        std::size_t i = slot.hash & mask();
+        while (slots_[i].row != empty) {
+            i = (i + 1) & mask();
+        }
+        slots_[i] = slot;
+    }
+
+public:
+    template<typename Match>
+    std::optional<std::uint32_t> find(std::uint64_t hash, Match&& match) const {
+        if (slots_.empty()) return std::nullopt;
+
+        for (std::size_t i = hash & mask();; i = (i + 1) & mask()) {
+            const Slot& slot = slots_[i];
+            if (slot.row == empty) return std::nullopt;
+            if (slot.hash == hash && match(slot.row)) return slot.row;
+        }
+    }
+
+    // Start loading the home slot of `hash` (batch lookups issue this early)
+    void prefetch(std::uint64_t hash) const {
+        if (!slots_.empty()) indexed_style::prefetch(&slots_[hash & mask()]);
+    }
+
+    // First row whose stored hash matches, without comparing keys. Only good
+    // as a prefetch hint; find() is still needed to confirm the match.
+    std::optional<std::uint32_t> peek(std::uint64_t hash) const {
+        if (slots_.empty()) return std::nullopt;
+
+        for (std::size_t i = hash & mask(); slots_[i].row != empty; i = (i + 1) & mask()) {
+            if (slots_[i].hash == hash) return slots_[i].row;
+        }
+        return std::nullopt;
+    }
+
+    void insert(std::uint64_t hash, std::uint32_t row) {
+        // Keep the load factor under 3/4 so probe sequences stay short
+        if ((size_ + 1) * 4 > slots_.size() * 3) {
+            rehash(std::max<std::size_t>(16, slots_.size() * 2));
+        }
+        place({hash, row});
+        ++size_;
+    }
+
+    void erase(std::uint64_t hash, std::uint32_t row) {
+        // Backward-shift deletion: no tombstones, so lookups never slow down
+        std::size_t hole = slotOf(hash, row);
+        for (std::size_t j = (hole + 1) & mask(); slots_[j].row != empty; j = (j + 1) & mask()) {
+            std::size_t home = slots_[j].hash & mask();
+            // Move slots_[j] into the hole unless its home lies in (hole, j]
+            bool between = hole <= j ? (hole < home && home <= j)
+                                     : (hole < home || home <= j);
+            if (!between) {
+                slots_[hole] = slots_[j];
+                hole = j;
+            }
+        }
+        slots_[hole] = Slot{};
+        --size_;
+    }
+
+    // Point an existing entry at a different row (after the row moved)
+    void retarget(std::uint64_t hash, std::uint32_t from, std::uint32_t to) {
+        slots_[slotOf(hash, from)].row = to;
+    }
+
+    void reserve(std::size_t n) {
+        std::size_t capacity = 16;
+        while (capacity * 3 < n * 4) capacity *= 2;
+        if (capacity > slots_.size()) rehash(capacity);
+    }
+};
+
+// Same std::expected API as cpp23_style::UserDatabase, but users live in one
+// vector and both lookups are a hash plus a short linear probe
+class IndexedUserDatabase {
+    std::vector<User> users_;
+    FlatIndex by_id_;
+    FlatIndex by_email_;
+
+    static std::uint64_t hashId(int id) {
+        // SplitMix64 finalizer: spreads sequential ids across the table
+        auto x = static_cast<std::uint64_t>(static_cast<std::uint32_t>(id));
+        x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+        x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+        return x ^ (x >> 31);
+    }
+
+    static std::uint64_t hashEmail(std::string_view email) {
+        return std::hash<std::string_view>{}(email);
+    }
+
+    std::optional<std::uint32_t> rowOf(int id) const {
+        return by_id_.find(hashId(id), [&](std::uint32_t row) { return users_[row].id == id; });
+    }
+
+    std::optional<std::uint32_t> rowOfEmail(std::string_view email) const {
+        return by_email_.find(hashEmail(email),
+                              [&](std::uint32_t row) { return users_[row].email == email; });
+    }
+
+public:
+    IndexedUserDatabase() {
+        insert({1, "Alice", "alice@example.com"});
+        insert({2, "Bob", "bob@example.com"});
+        insert({3, "Charlie", "charlie@example.com"});
+    }
+
+    void reserve(std::size_t n) {
+        users_.reserve(n);
+        by_id_.reserve(n);
+        by_email_.reserve(n);
+    }
+
+    std::size_t size() const { return users_.size(); }
+
+    std::expected<void, UserError> insert(User user) {
+        if (user.id <= 0) {
+            return std::unexpected(UserError::InvalidId);
+        }
+        if (rowOf(user.id) || (!user.email.empty() && rowOfEmail(user.email))) {
+            return std::unexpected(UserError::AlreadyExists);
+        }
+
+        auto row = static_cast<std::uint32_t>(users_.size());
+        by_id_.insert(hashId(user.id), row);
+        if (!user.email.empty()) {
+            by_email_.insert(hashEmail(user.email), row);
+        }
+        users_.push_back(std::move(user));
+        return {};
+    }
+
+    std::expected<void, UserError> update(User user) {
+        auto row = rowOf(user.id);
+        if (!row) {
+            return std::unexpected(UserError::NotFound);
+        }
+
+        User& current = users_[*row];
+        if (current.email != user.email) {
+            if (!user.email.empty() && rowOfEmail(user.email)) {
+                return std::unexpected(UserError::AlreadyExists);
+            }
+            if (!current.email.empty()) by_email_.erase(hashEmail(current.email), *row);
+            if (!user.email.empty()) by_email_.insert(hashEmail(user.email), *row);
+        }
+        current = std::move(user);
+        return {};
+    }
+
+    std::expected<void, UserError> remove(int id) {
+        auto row = rowOf(id);
+        if (!row) {
+            return std::unexpected(UserError::NotFound);
+        }
+
+        const User& gone = users_[*row];
+        by_id_.erase(hashId(gone.id), *row);
+        if (!gone.email.empty()) by_email_.erase(hashEmail(gone.email), *row);
+
+        // Keep storage dense: move the last user into the freed row
+        auto last = static_cast<std::uint32_t>(users_.size() - 1);
+        if (*row != last) {
+            const User& moved = users_[last];
+            by_id_.retarget(hashId(moved.id), last, *row);
+            if (!moved.email.empty()) by_email_.retarget(hashEmail(moved.email), last, *row);
+            users_[*row] = std::move(users_[last]);
+        }
+        users_.pop_back();
+        return {};
+    }
+
+    std::expected<User, UserError> findUser(int id) const {
+        TRACE_SCOPE("indexed findUser");
+
+        if (id <= 0) {
+            return std::unexpected(UserError::InvalidId);
+        }
+
+        auto row = rowOf(id);
+        if (!row) {
+            return std::unexpected(UserError::NotFound);
+        }
+
+        return users_[*row];
+    }
+
+    // Zero-copy lookup, valid until the next insert/update/remove
+    std::expected<std::reference_wrapper<const User>, UserError> findUserRef(int id) const {
+        if (id <= 0) {
+            return std::unexpected(UserError::InvalidId);
+        }
+
+        auto row = rowOf(id);
+        if (!row) {
+            return std::unexpected(UserError::NotFound);
+        }
+
+        return std::cref(users_[*row]);
+    }
+
+    std::expected<std::string_view, UserError> getUserEmailView(int id) const {
+        return findUserRef(id)
+            .and_then([](const User& user) -> std::expected<std::string_view, UserError> {
+                if (user.email.empty()) {
+                    return std::unexpected(UserError::DatabaseError);
+                }
+                return user.email;
+            });
+    }
+
+    using UserRef = std::expected<std::reference_wrapper<const User>, UserError>;
+
+    // Batch lookup. A lookup is two dependent cache misses (index slot, then
+    // user row), so the loop runs a software pipeline: slots are prefetched
+    // `distance` ids ahead, user rows half that far ahead, and the lookup
+    // itself then mostly hits cache. Misses of consecutive ids overlap
+    // instead of being paid one after another.
+    void findUsers(std::span<const int> ids, std::vector<UserRef>& out) const {
+        constexpr std::size_t distance = 16;
+        TRACE_SCOPE("indexed findUsers");
+        TRACE_COUNTER("findUsers batch", ids.size());
+
+        out.clear();
+        out.reserve(ids.size());
+
+        for (std::size_t i = 0; i < ids.size(); ++i) {
+            if (i + distance < ids.size()) {
+                by_id_.prefetch(hashId(ids[i + distance]));
+            }
+            if (i + distance / 2 < ids.size()) {
+                if (auto row = by_id_.peek(hashId(ids[i + distance / 2]))) {
+                    indexed_style::prefetch(&users_[*row]);
+                }
+            }
+            out.push_back(findUserRef(ids[i]));
+        }
+    }
+
+    std::vector<UserRef> findUsers(std::span<const int> ids) const {
+        std::vector<UserRef> out;
+        findUsers(ids, out);
+        return out;
+    }
+
+    // Secondary index: no scan over all users
+    std::expected<User, UserError> findUserByEmail(std::string_view email) const {
+        auto row = rowOfEmail(email);
+        if (!row) {
+            return std::unexpected(UserError::NotFound);
+        }
+
+        return users_[*row];
+    }
+
+    // Built on the view: only the returned email is copied, never the User
+    std::expected<std::string, UserError> getUserEmail(int id) const {
+        return getUserEmailView(id)
+            .transform([](std::string_view email) { return std::string(email); });
+    }
+
+    std::expected<std::string, UserError> getUserNameUpper(int id) const {
+        return findUserRef(id)
+            .transform([](const User& user) {
+                std::string upper = user.name;
+                for (char& c : upper) c = std::toupper(c);
+                return upper;
+            });
+    }
+
+    std::expected<User, std::string> findUserWithMessage(int id) const {
+        return findUser(id)
+            .or_else([](UserError error) -> std::expected<User, std::string> {
+                return std::unexpected(errorMessage(error));
+            });
+    }
+
+    std::expected<User, std::string_view> findUserWithMessageView(int id) const {
+        return findUser(id)
+            .or_else([](UserError error) -> std::expected<User, std::string_view> {
+                return std::unexpected(errorMessageView(error));
+            });
+    }
+};
+
+void demo() {
+    std::println("=== Indexed Style: Flat Hash Indexes ===\n");
+
+    IndexedUserDatabase db;
+
+    // Same API as cpp23_style::UserDatabase
+    if (auto user = db.findUser(2)) {
+        std::println("Found user: {} ({})", user->name, user->email);
+    }
+    if (auto user = db.findUserByEmail("charlie@example.com")) {
+        std::println("Found by email: {} (id {})", user->name, user->id);
+    }
+    std::println("Missing: {}", errorMessageView(db.findUser(999).error()));
+    std::println("Email view: {}", db.getUserEmailView(1).value_or("none"));
+
+    // Writes keep both indexes and the dense storage consistent
+    if (auto dup = db.insert({4, "Dana", "bob@example.com"}); !dup) {
+        std::println("Insert rejected: {}", errorMessageView(dup.error()));
+    }
+    db.remove(1);
+    db.update({3, "Charlie", "charlie@example.org"});
+    std::println("After remove/update: {} users, id 3 email = {}",
+                db.size(), db.getUserEmail(3).value_or("none"));
+
+    // Scale test against std::map storage
+    constexpr int count = 200'000;
+    IndexedUserDatabase indexed;
+    indexed.reserve(count);
+    std::map<int, User> ordered;
+    for (int id = 4; id < count; ++id) {
+        User user{id, "user" + std::to_string(id), "user" + std::to_string(id) + "@example.com"};
+        ordered.emplace(id, user);
+        indexed.insert(std::move(user));
+    }
+    // The indexed database starts with ids 1-3; give the map the same users
+    for (int id = 1; id < 4; ++id) {
+        if (auto user = indexed.findUser(id)) ordered.emplace(id, std::move(*user));
+    }
+
+    auto time_lookups = [&](auto&& lookup) {
+        std::size_t found = 0;
+        auto start = std::chrono::steady_clock::now();
+        for (int id = 1; id <= count; ++id) {
+            // Visit every id once, in a scattered order
+            int key = static_cast<int>((static_cast<std::uint64_t>(id) * 7919) % count) + 1;
+            found += lookup(key);
+        }
+        std::chrono::duration<double, std::nano> elapsed = std::chrono::steady_clock::now() - start;
+        return std::pair{elapsed.count() / count, found};
+    };
+
+    auto [map_ns, map_found] = time_lookups([&](int id) { return ordered.contains(id); });
+    auto [flat_ns, flat_found] = time_lookups([&](int id) {
+        return indexed.findUser(id).has_value();
+    });
+    auto [ref_ns, ref_found] = time_lookups([&](int id) {
+        return indexed.getUserEmailView(id).has_value();
+    });
+
+    std::println("\n{} random lookups:", count);
+    std::println("  std::map::contains:        {:.1f} ns/lookup ({} hits)", map_ns, map_found);
+    std::println("  IndexedUserDatabase::find: {:.1f} ns/lookup ({} hits, incl. User copy)",
+                flat_ns, flat_found);
+    std::println("  IndexedUserDatabase::view: {:.1f} ns/lookup ({} hits, zero-copy)",
+                ref_ns, ref_found);
+
+    // Batch API: 10k ids per request, one reused result vector
+    constexpr std::size_t per_request = 10'000;
+    std::vector<int> ids(count);
+    for (int i = 0; i < count; ++i) {
+        ids[i] = static_cast<int>((static_cast<std::uint64_t>(i + 1) * 7919) % count) + 1;
+    }
+    ids.back() = -1;  // Errors are reported per id, like single lookups
+
+    std::vector<IndexedUserDatabase::UserRef> results;
+    std::size_t batch_found = 0;
+    std::size_t invalid = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (std::size_t offset = 0; offset < ids.size(); offset += per_request) {
+        auto request = std::span(ids).subspan(offset, std::min(per_request, ids.size() - offset));
+        indexed.findUsers(request, results);
+        for (const auto& result : results) {
+            if (result) ++batch_found;
+            else if (result.error() == UserError::InvalidId) ++invalid;
+        }
+    }
+    std::chrono::duration<double, std::nano> batch_time = std::chrono::steady_clock::now() - start;
+    std::println("  IndexedUserDatabase::findUsers: {:.1f} ns/lookup ({} hits, {} invalid)",
+                batch_time.count() / count, batch_found, invalid);
+
+    // Advantages over std::map<int, User>:
+    // - One contiguous array of users (no node per user)
+    // - O(1) expected lookup with short, cache-friendly probes
+    // - Email lookups use a secondary index instead of a scan
+    // - Removal keeps storage dense (swap with last, no tombstones)
+
+    std::println("");
+}
+
+} // namespace indexed_style
+
+// ============================================================================
+// Concurrent Style: Read-mostly database with RCU-like snapshots
+// ============================================================================
+
+namespace concurrent_style {
+
+using cpp23_style::User;
+using cpp23_style::UserError;
+using indexed_style::IndexedUserDatabase;
+
+// Readers never take a lock. The current state is an immutable snapshot
+// published through an atomic shared_ptr; writers are serialized by a mutex,
+// copy the snapshot, modify the copy and publish it (read-copy-update).
+// Old snapshots are reclaimed by reference counting once the last reader
+// lets go of them.
+//
+// Loading an atomic shared_ptr still bumps a shared reference count, which
+// would become the new bottleneck at high core counts. Each thread therefore
+// uses a Reader that caches the snapshot and only reloads it when the
+// published version number changes - a plain atomic load that every core
+// can serve from its own cache.
+//
+// Trade-off: every write copies the database. Use batch() to apply many
+// changes for the price of one copy.
+class ConcurrentUserDatabase {
+    using Snapshot = std::shared_ptr<const IndexedUserDatabase>;
+
+    std::atomic<Snapshot> current_;
+    std::atomic<std::uint64_t> version_{0};
+    std::mutex write_mutex_;
+
+    void publish(Snapshot next) {
+        current_.store(std::move(next), std::memory_order_release);
+        version_.fetch_add(1, std::memory_order_release);
+    }
+
+public:
+    ConcurrentUserDatabase()
+        : current_(std::make_shared<const IndexedUserDatabase>()) {}
+
+    // Per-thread read handle. Results that refer into the database (views)
+    // stay valid until the next call on the same Reader.
+    class Reader {
+        const ConcurrentUserDatabase* db_;
+        Snapshot snapshot_;
+        std::uint64_t version_ = 0;
+
+        const IndexedUserDatabase& refresh() {
+            auto latest = db_->version_.load(std::memory_order_acquire);
+            if (latest != version_ || !snapshot_) {
+                snapshot_ = db_->current_.load(std::memory_order_acquire);
+                version_ = latest;
+            }
+            return *snapshot_;
+        }
+
+    public:
+        explicit Reader(const ConcurrentUserDatabase& db) : db_(&db) {}
+
+        std::expected<User, UserError> findUser(int id) {
+            return refresh().findUser(id);
+        }
+
+        std::expected<std::string_view, UserError> getUserEmailView(int id) {
+            return refresh().getUserEmailView(id);
+        }
+
+        std::expected<std::string, UserError> getUserEmail(int id) {
+            return refresh().getUserEmail(id);
+        }
+    };
+
+    Reader reader() const { return Reader(*this); }
+
+    // Convenience for occasional reads (reloads the snapshot every call)
+    std::expected<User, UserError> findUser(int id) const {
+        return current_.load(std::memory_order_acquire)->findUser(id);
+    }
+
+    std::expected<std::string, UserError> getUserEmail(int id) const {
+        return current_.load(std::memory_order_acquire)->getUserEmail(id);
+    }
+
+    // Apply several modifications as a single published update
+    template<typename F>
+    requires std::invocable<F&, IndexedUserDatabase&>
+    auto batch(F&& modify) {
+        std::lock_guard lock(write_mutex_);
+        auto next = std::make_shared<IndexedUserDatabase>(*current_.load(std::memory_order_acquire));
+        auto result = modify(*next);
+        publish(std::move(next));
+        return result;
+    }
+
+    std::expected<void, UserError> insert(User user) {
+        return batch([&](IndexedUserDatabase& db) { return db.insert(std::move(user)); });
+    }
+
+    std::expected<void, UserError> update(User user) {
+        return batch([&](IndexedUserDatabase& db) { return db.update(std::move(user)); });
+    }
+
+    std::expected<void, UserError> remove(int id) {
+        return batch([&](IndexedUserDatabase& db) { return db.remove(id); });
+    }
+};
+
+// What we're replacing: one lock around the whole database
+class MutexUserDatabase {
+    IndexedUserDatabase db_;
+    mutable std::mutex mutex_;
+
+public:
+    explicit MutexUserDatabase(IndexedUserDatabase db) : db_(std::move(db)) {}
+
+    std::expected<std::string, UserError> getUserEmail(int id) const {
+        std::lock_guard lock(mutex_);
+        return db_.getUserEmail(id);
+    }
+
+    std::expected<void, UserError> update(User user) {
+        std::lock_guard lock(mutex_);
+        return db_.update(std::move(user));
+    }
+};
+
+// Run `work(thread_index)` on `threads` threads released at the same moment;
+// returns the wall time in seconds
+template<typename Work>
+double runThreads(unsigned threads, Work work) {
+    std::latch ready(threads + 1);
+    std::vector<std::jthread> pool;
+    for (unsigned t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            ready.arrive_and_wait();
+            work(t);
+        });
+    }
+
+    auto start = std::chrono::steady_clock::now();
+    ready.arrive_and_wait();
+    pool.clear();  // Joins every thread
+    return std::chrono::duration<double>(std::chrono::steady_clock::now() - start).count();
+}
+
+void benchmark() {
+    constexpr int users = 100'000;
+    constexpr int lookups_per_thread = 1'000'000;
+
+    IndexedUserDatabase seed;
+    seed.reserve(users);
+    for (int id = 4; id <= users; ++id) {
+        seed.insert({id, "user" + std::to_string(id), "user" + std::to_string(id) + "@example.com"});
+    }
+
+    ConcurrentUserDatabase db;
+    db.batch([&](IndexedUserDatabase& d) {
+        d = seed;
+        return d.size();
+    });
+    MutexUserDatabase locked(seed);
+
+    auto key = [](unsigned thread, int i) {
+        return static_cast<int>((static_cast<std::uint64_t>(i) * 7919 + thread * 104'729) % users) + 1;
+    };
+
+    unsigned max_threads = std::max(1u, std::thread::hardware_concurrency());
+    std::println("Reader throughput (one writer updating concurrently), {} hardware threads:",
+                max_threads);
+    std::println("  {:>7}  {:>14}  {:>14}", "threads", "RCU Mops/s", "mutex Mops/s");
+
+    // A writer keeps updating `target` while `readers` is timed. Both sides
+    // run the same lookup, copying the email out: a view could not outlive
+    // the mutex side's lock.
+    auto withWriter = [&](auto& target, auto readers) {
+        std::atomic<bool> stop_writer{false};
+        std::jthread writer([&] {
+            for (int round = 0; !stop_writer.load(std::memory_order_relaxed); ++round) {
+                int id = round % (users - 3) + 4;
+                target.update({id, "user" + std::to_string(id), "u" + std::to_string(round) + "@example.com"});
+                std::this_thread::sleep_for(std::chrono::milliseconds(5));
+            }
+        });
+        double seconds = readers();
+        stop_writer = true;
+        return seconds;
+    };
+
+    for (unsigned threads = 1; threads <= max_threads; threads *= 2) {
+        std::atomic<std::size_t> sink{0};
+
+        double rcu = withWriter(db, [&] {
+            return runThreads(threads, [&](unsigned t) {
+                auto reader = db.reader();
+                std::size_t found = 0;
+                for (int i = 0; i < lookups_per_thread; ++i) {
+                    found += reader.getUserEmail(key(t, i)).has_value();
+                }
+                sink += found;
+            });
+        });
+
+        double mutex = withWriter(locked, [&] {
+            return runThreads(threads, [&](unsigned t) {
+                std::size_t found = 0;
+                for (int i = 0; i < lookups_per_thread; ++i) {
+                    found += locked.getUserEmail(key(t, i)).has_value();
+                }
+                sink += found;
+            });
+        });
+
+        double total = static_cast<double>(threads) * lookups_per_thread / 1e6;
+        std::println("  {:>7}  {:>14.1f}  {:>14.1f}", threads, total / rcu, total / mutex);
+    }
+}
+
+void demo() {
+    std::println("=== Concurrent Style: Lock-Free Readers ===\n");
+
+    ConcurrentUserDatabase db;
+    auto reader = db.reader();
+
+    std::println("Before update: {}", reader.getUserEmail(2).value_or("none"));
+    db.update({2, "Bob", "bob@example.org"});
+    std::println("After update:  {}", reader.getUserEmail(2).value_or("none"));
+
+    // Batched writes are published atomically: readers see all or none
+    db.batch([](IndexedUserDatabase& d) {
+        d.insert({4, "Dana", "dana@example.com"});
+        d.insert({5, "Eve", "eve@example.com"});
+        return d.remove(1);
+    });
+    std::println("After batch:   id 1 -> {}, id 5 -> {}",
+                cpp23_style::errorMessageView(db.findUser(1).error()),
+                db.findUser(5).transform([](const User& u) { return u.name; }).value_or("none"));
+
+    std::println("");
+    benchmark();
+
+    std::println("");
+}
+
+} // namespace concurrent_style
+
+// ============================================================================
+// PMR Style: Request-scoped memory for lookup results
+// ============================================================================
+
+namespace pmr_style {
+
+using cpp23_style::UserError;
+using cpp23_style::errorMessageView;
+
+// Allocator-aware User: its strings allocate from whatever memory resource
+// the User was constructed with. The allocator_type typedef and the
+// trailing-allocator constructors let pmr containers pass their resource
+// down to every element they create (uses-allocator construction).
+struct User {
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    int id = 0;
+    std::pmr::string name;
+    std::pmr::string email;
+
+    explicit User(allocator_type alloc = {}) : name(alloc), email(alloc) {}
+
+    User(int id, std::string_view name, std::string_view email, allocator_type alloc = {})
+        : id(id), name(name, alloc), email(email, alloc) {}
+
+    User(const User& other, allocator_type alloc = {})
+        : id(other.id), name(other.name, alloc), email(other.email, alloc) {}
+
+    User(User&& other) noexcept = default;
+    User(User&& other, allocator_type alloc)
+        : id(other.id), name(std::move(other.name), alloc), email(std::move(other.email), alloc) {}
+
+    User& operator=(const User&) = default;
+    User& operator=(User&&) = default;
+
+    allocator_type get_allocator() const { return name.get_allocator(); }
+};
+
+// Same lookups as cpp23_style::UserDatabase. Storage uses the resource
+// given at construction; results are built in a resource chosen per call,
+// typically a monotonic arena that lives exactly as long as one request.
+class UserDatabase {
+    std::pmr::map<int, User> users_;
+
+public:
+    explicit UserDatabase(std::pmr::memory_resource* resource = std::pmr::get_default_resource())
+        : users_(resource) {
+        insert({1, "Alice", "alice@example.com"});
+        insert({2, "Bob", "bob@example.com"});
+        insert({3, "Charlie", "charlie@example.com"});
+    }
+
+    void insert(const User& user) {
+        users_.insert_or_assign(user.id, user);  // Copied into the map's resource
+    }
+
+    std::size_t size() const { return users_.size(); }
+
+    std::expected<std::reference_wrapper<const User>, UserError> findUserRef(int id) const {
+        if (id <= 0) {
+            return std::unexpected(UserError::InvalidId);
+        }
+
+        auto it = users_.find(id);
+        if (it == users_.end()) {
+            return std::unexpected(UserError::NotFound);
+        }
+
+        return std::cref(it->second);
+    }
+
+    // The copy's strings live in `resource`, not on the global heap
+    std::expected<User, UserError> findUser(int id, std::pmr::memory_resource* resource) const {
+        return findUserRef(id).transform([resource](const User& user) {
+            return User(user, resource);
+        });
+    }
+
+    struct Batch {
+        std::pmr::vector<User> users;
+        std::pmr::vector<std::pair<int, UserError>> errors;
+
+        explicit Batch(std::pmr::memory_resource* resource) : users(resource), errors(resource) {}
+    };
+
+    // Look up many ids at once. Every byte of the result, vectors and
+    // strings alike, comes from `resource`.
+    Batch findUsers(std::span<const int> ids, std::pmr::memory_resource* resource) const {
+        Batch batch(resource);
+        batch.users.reserve(ids.size());
+
+        for (int id : ids) {
+            if (auto user = findUserRef(id)) {
+                batch.users.emplace_back(user->get());  // Copy uses the vector's resource
+            } else {
+                batch.errors.emplace_back(id, user.error());
+            }
+        }
+        return batch;
+    }
+};
+
+void demo() {
+    std::println("=== PMR Style: Request-Scoped Arenas ===\n");
+
+    UserDatabase db;
+
+    // One request: a stack buffer backs every result. The null upstream
+    // resource proves nothing spills to the heap (it would throw).
+    {
+        std::array<std::byte, 4096> buffer;
+        std::pmr::monotonic_buffer_resource request(buffer.data(), buffer.size(),
+                                                    std::pmr::null_memory_resource());
+
+        const std::array ids{1, 2, 999, 3, -1, 2};
+        alloc::Scope scope;
+        auto batch = db.findUsers(ids, &request);
+        auto stats = scope.stats();
+
+        std::println("Batch of {} lookups:", ids.size());
+        for (const auto& user : batch.users) {
+            std::println("  {} <{}>", user.name, user.email);
+        }
+        for (auto [id, error] : batch.errors) {
+            std::println("  id {}: {}", id, errorMessageView(error));
+        }
+        std::println("  Heap allocations: {}", stats.count);
+    }  // The whole request is released at once; no per-string frees
+
+    // Single lookups into a caller-chosen resource
+    {
+        std::pmr::monotonic_buffer_resource request;
+        if (auto user = db.findUser(2, &request)) {
+            std::println("\nfindUser(2) -> {} (allocated from the request arena: {})",
+                         user->name, user->get_allocator().resource() == &request);
+        }
+    }
+
+    // Many requests: arena vs default heap for a 1000-id batch
+    std::vector<int> ids(1'000);
+    for (std::size_t i = 0; i < ids.size(); ++i) {
+        ids[i] = static_cast<int>(i % 4);  // Mix of hits and misses
+    }
+
+    bench::Suite suite("example1.batch_lookup");
+    suite.run("default heap per request", ids.size(), [&] {
+        return db.findUsers(ids, std::pmr::new_delete_resource()).users.size();
+    });
+
+    std::vector<std::byte> scratch(256 * 1024);  // Reused by every request
+    suite.run("monotonic arena per request", ids.size(), [&] {
+        std::pmr::monotonic_buffer_resource request(scratch.data(), scratch.size());
+        return db.findUsers(ids, &request).users.size();
+    });
+    suite.report();
+
+    std::println("");
+}
+
+} // namespace pmr_style
+
+// ============================================================================
+// Allocation Audit: Heap traffic of each lookup chain
+// ============================================================================
+
+// Run one lookup inside an alloc::Scope and print what it allocated.
+// The result is inspected afterwards so the work can't be optimized away.
+template<typename Lookup>
+void auditLookup(std::string_view label, Lookup&& lookup) {
+    alloc::Scope scope;
+    auto result = lookup();
+    auto stats = scope.stats();
+    std::println("  {:<48} {:>6} {:>7} {:>7}   {}", label, stats.count, stats.bytes,
+                 stats.peak_bytes, static_cast<bool>(result) ? "value" : "error");
+}
+
+void allocation_demo() {
+    std::println("=== Allocation Audit: Lookup Chains ===\n");
+
+    cpp11_style::UserDatabase db11;
+    cpp17_style::UserDatabase db17;
+    cpp23_style::UserDatabase db23;
+    indexed_style::IndexedUserDatabase indexed;
+
+    std::println("  {:<48} {:>6} {:>7} {:>7}", "", "allocs", "bytes", "peak");
+
+    auditLookup("cpp11 findUser(1, &user)", [&] {
+        cpp11_style::User user;
+        return db11.findUser(1, &user) == cpp11_style::ErrorCode::Success;
+    });
+    auditLookup("cpp11 getUserPtr(1)", [&] { return db11.getUserPtr(1); });
+    auditLookup("cpp17 findUser(1)", [&] { return db17.findUser(1); });
+    auditLookup("cpp17 getUserEmail(1)", [&] { return db17.getUserEmail(1); });
+
+    auditLookup("cpp23 findUser(1)", [&] { return db23.findUser(1); });
+    auditLookup("cpp23 findUserRef(1)", [&] { return db23.findUserRef(1); });
+    auditLookup("cpp23 getUserEmail(1): findUser | and_then", [&] { return db23.getUserEmail(1); });
+    auditLookup("cpp23 getUserEmailView(1)", [&] { return db23.getUserEmailView(1); });
+    auditLookup("cpp23 getUserNameUpper(3): findUser | transform", [&] { return db23.getUserNameUpper(3); });
+    auditLookup("cpp23 findUserWithMessage(999): or_else", [&] { return db23.findUserWithMessage(999); });
+    auditLookup("cpp23 findUserWithMessageView(999)", [&] { return db23.findUserWithMessageView(999); });
+
+    auditLookup("indexed findUser(1)", [&] { return indexed.findUser(1); });
+    auditLookup("indexed getUserEmailView(1)", [&] { return indexed.getUserEmailView(1); });
+
+    std::array<std::byte, 1024> buffer;
+    std::pmr::monotonic_buffer_resource request(buffer.data(), buffer.size());
+    pmr_style::UserDatabase pmr_db;
+    auditLookup("pmr findUser(1) into a request arena", [&] { return pmr_db.findUser(1, &request); });
+
+    // Short strings fit the small-string buffer, so "Alice" is free to copy
+    // but "alice@example.com" is not: copying a User costs one allocation
+    // per long field, while the reference and view chains cost none.
+
+    std::println("");
+}
+
 // ============================================================================
 // Comparison: Same operation in all three styles
 // ============================================================================
@@ -382,7 +1372,12 @@ int main() {
     cpp11_style::demo();
     cpp17_style::demo();
     cpp23_style::demo();
+    indexed_style::demo();
+    concurrent_style::demo();
+    pmr_style::demo();
+    allocation_demo();
     comparison_demo();
 
+    trace::report();
     return 0;
 }
@@ -15,6 +15,43 @@
 #include <numeric>
 #include <ranges>      // C++20
 #include <print>       // C++23
+#include <format>      // C++20
+#include <span>        // C++20
+#include <string_view>
+#include <unordered_map>
+#include <functional>
+#include <optional>
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <array>
+#include <bit>         // C++20
+#include <chrono>
+#include <cmath>
+#include <random>
+#include <atomic>
+#include <condition_variable>
+#include <deque>
+#include <exception>
+#include <memory>
+#include <memory_resource>
+#include <mutex>
+#include <stop_token>  // C++20
+#include <thread>
+#include <type_traits>
+#include <charconv>
+#include <istream>
+#include <sstream>
+#include <utility>
+
+#include "benchmark.hpp"
+#include "trace.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 struct Product {
     std::string name;
@@ -45,12 +82,9 @@ std::vector<Product> getProducts() {
 
 namespace cpp11_style {
 
-void demo() {
-    std::cout << "=== C++11 Style: Manual Loops ===\n\n";
-
-    auto products = getProducts();
-
-    // Task: Get names of products > $100 with 10% discount applied
+// Task: Get names of products > $100 with 10% discount applied
+std::vector<std::string> expensiveWithDiscount(const std::vector<Product>& products) {
+    TRACE_SCOPE("cpp11 expensiveWithDiscount");
     std::vector<std::string> result;
 
     for (const auto& product : products) {
@@ -60,19 +94,33 @@ void demo() {
                            std::to_string(discounted) + ")");
         }
     }
+    return result;
+}
 
-    std::cout << "Expensive products with discount:\n";
-    for (const auto& item : result) {
-        std::cout << "  " << item << "\n";
-    }
-
-    // Calculate total stock value for electronics
+// Calculate total stock value for electronics
+double electronicsValue(const std::vector<Product>& products) {
+    TRACE_SCOPE("cpp11 electronicsValue");
     double total = 0.0;
     for (const auto& product : products) {
         if (product.category == "Electronics") {
             total += product.price * product.stock;
         }
     }
+    return total;
+}
+
+void demo() {
+    std::cout << "=== C++11 Style: Manual Loops ===\n\n";
+
+    auto products = getProducts();
+    std::vector<std::string> result = expensiveWithDiscount(products);
+
+    std::cout << "Expensive products with discount:\n";
+    for (const auto& item : result) {
+        std::cout << "  " << item << "\n";
+    }
+
+    double total = electronicsValue(products);
     std::cout << "\nTotal electronics value: $" << total << "\n";
 
     // Problems:
@@ -93,12 +141,9 @@ void demo() {
 
 namespace cpp17_style {
 
-void demo() {
-    std::cout << "=== C++17 Style: Standard Algorithms ===\n\n";
-
-    auto products = getProducts();
-
-    // Using copy_if and transform
+// Using copy_if and transform
+std::vector<std::string> expensiveWithDiscount(const std::vector<Product>& products) {
+    TRACE_SCOPE("cpp17 expensiveWithDiscount");
     std::vector<Product> expensive;
     std::copy_if(products.begin(), products.end(),
                 std::back_inserter(expensive),
@@ -111,21 +156,33 @@ void demo() {
                       double discounted = p.price * 0.9;
                       return p.name + " ($" + std::to_string(discounted) + ")";
                   });
+    return result;
+}
 
-    std::cout << "Expensive products with discount:\n";
-    for (const auto& item : result) {
-        std::cout << "  " << item << "\n";
-    }
-
-    // Using accumulate with lambda
-    double total = std::accumulate(products.begin(), products.end(), 0.0,
+// Using accumulate with lambda
+double electronicsValue(const std::vector<Product>& products) {
+    TRACE_SCOPE("cpp17 electronicsValue");
+    return std::accumulate(products.begin(), products.end(), 0.0,
         [](double sum, const Product& p) {
             if (p.category == "Electronics") {
                 return sum + (p.price * p.stock);
             }
             return sum;
         });
+}
+
+void demo() {
+    std::cout << "=== C++17 Style: Standard Algorithms ===\n\n";
+
+    auto products = getProducts();
+    std::vector<std::string> result = expensiveWithDiscount(products);
 
+    std::cout << "Expensive products with discount:\n";
+    for (const auto& item : result) {
+        std::cout << "  " << item << "\n";
+    }
+
+    double total = electronicsValue(products);
     std::cout << "\nTotal electronics value: $" << total << "\n";
 
     // Better than raw loops:
@@ -149,24 +206,38 @@ void demo() {
 
 namespace cpp20_style {
 
-void demo() {
-    std::println("=== C++20 Style: Ranges and Views ===\n");
-
-    auto products = getProducts();
-
-    // Lazy evaluation with views - no temporary containers!
-    auto expensive_discounted = products
+// Lazy evaluation with views - no temporary containers!
+// The view refers to `products`, which must outlive it.
+auto expensiveWithDiscount(const std::vector<Product>& products) {
+    return products
         | std::views::filter([](const Product& p) { return p.price > 100.0; })
         | std::views::transform([](const Product& p) {
               double discounted = p.price * 0.9;
               return p.name + " ($" + std::to_string(discounted) + ")";
           });
+}
+
+auto electronicsValues(const std::vector<Product>& products) {
+    return products
+        | std::views::filter([](const Product& p) { return p.category == "Electronics"; })
+        | std::views::transform([](const Product& p) { return p.price * p.stock; });
+}
+
+void demo() {
+    std::println("=== C++20 Style: Ranges and Views ===\n");
+
+    auto products = getProducts();
+    auto expensive_discounted = expensiveWithDiscount(products);
 
     std::println("Expensive products with discount:");
     for (const auto& item : expensive_discounted) {
         std::println("  {}", item);
     }
 
+    double total = 0.0;
+    for (double value : electronicsValues(products)) total += value;
+    std::println("\nTotal electronics value: ${:.2f}", total);
+
     // More complex pipeline: Top 3 electronics by stock value
     auto top_electronics = products
         | std::views::filter([](const Product& p) {
@@ -302,35 +373,1619 @@ void demo() {
 
 } // namespace cpp23_style
 
+// ============================================================================
+// Columnar Style: Structure-of-arrays ProductTable
+// ============================================================================
+
+namespace columnar {
+
+// A scan like `price > 100.0` only needs prices, but a std::vector<Product>
+// drags every name and category string through cache with it. ProductTable
+// stores each field in its own contiguous column instead:
+//   - prices, stocks: plain arrays
+//   - categories: dictionary-encoded as small integer ids
+//   - names: one character arena plus an offset array (no per-name allocation)
+
+// Non-owning view of one row, produced on demand by the table
+struct ProductRef {
+    std::string_view name;
+    double price;
+    std::string_view category;
+    int stock;
+};
+
+class ProductTable {
+    // Heterogeneous lookup: find a category id from a string_view without
+    // building a std::string
+    struct StringHash {
+        using is_transparent = void;
+        std::size_t operator()(std::string_view s) const {
+            return std::hash<std::string_view>{}(s);
+        }
+    };
+
+    std::vector<double> prices_;
+    std::vector<int> stocks_;
+    std::vector<std::uint32_t> category_ids_;
+
+    std::vector<std::string> categories_;  // id -> name
+    std::unordered_map<std::string, std::uint32_t, StringHash, std::equal_to<>> category_index_;
+
+    std::string name_arena_;
+    std::vector<std::uint32_t> name_offsets_{0};  // Row i spans [offsets[i], offsets[i + 1])
+
+    std::uint32_t internCategory(std::string_view category) {
+        if (auto it = category_index_.find(category); it != category_index_.end()) {
+            return it->second;
+        }
+        auto id = static_cast<std::uint32_t>(categories_.size());
+        categories_.emplace_back(category);
+        category_index_.emplace(categories_.back(), id);
+        return id;
+    }
+
+public:
+    ProductTable() = default;
+
+    explicit ProductTable(std::span<const Product> products) {
+        std::size_t name_bytes = 0;
+        for (const auto& p : products) name_bytes += p.name.size();
+        reserve(products.size(), name_bytes);
+
+        for (const auto& p : products) {
+            push_back(p.name, p.price, p.category, p.stock);
+        }
+    }
+
+    void reserve(std::size_t rows, std::size_t name_bytes = 0) {
+        prices_.reserve(rows);
+        stocks_.reserve(rows);
+        category_ids_.reserve(rows);
+        name_offsets_.reserve(rows + 1);
+        name_arena_.reserve(name_bytes);
+    }
+
+    void push_back(std::string_view name, double price, std::string_view category, int stock) {
+        if (name_arena_.size() + name.size() > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("ProductTable name arena exceeds 4 GiB");
+        }
+        name_arena_ += name;
+        name_offsets_.push_back(static_cast<std::uint32_t>(name_arena_.size()));
+
+        prices_.push_back(price);
+        stocks_.push_back(stock);
+        category_ids_.push_back(internCategory(category));
+    }
+
+    // Drop all rows but keep capacity (and the category dictionary) for reuse
+    void clear() {
+        prices_.clear();
+        stocks_.clear();
+        category_ids_.clear();
+        name_arena_.clear();
+        name_offsets_.assign(1, 0);
+    }
+
+    std::size_t size() const { return prices_.size(); }
+    bool empty() const { return prices_.empty(); }
+    std::size_t nameBytes() const { return name_arena_.size(); }
+
+    // Column access
+    std::span<const double> prices() const { return prices_; }
+    std::span<const int> stocks() const { return stocks_; }
+    std::span<const std::uint32_t> categoryIds() const { return category_ids_; }
+
+    std::string_view name(std::size_t row) const {
+        return std::string_view(name_arena_).substr(
+            name_offsets_[row], name_offsets_[row + 1] - name_offsets_[row]);
+    }
+
+    // Category dictionary
+    std::size_t categoryCount() const { return categories_.size(); }
+    std::string_view categoryName(std::uint32_t id) const { return categories_[id]; }
+
+    std::optional<std::uint32_t> categoryId(std::string_view category) const {
+        auto it = category_index_.find(category);
+        if (it == category_index_.end()) return std::nullopt;
+        return it->second;
+    }
+
+    ProductRef row(std::size_t i) const {
+        return {name(i), prices_[i], categories_[category_ids_[i]], stocks_[i]};
+    }
+
+    // Row indices as a range: filter on one column, then materialize rows
+    auto indices() const { return std::views::iota(std::size_t{0}, size()); }
+
+    auto rows() const {
+        return indices() | std::views::transform([this](std::size_t i) { return row(i); });
+    }
+};
+
+void demo() {
+    std::println("=== Columnar Style: ProductTable ===\n");
+
+    auto products = getProducts();
+    ProductTable table(products);
+
+    std::println("{} rows, {} categories, {} name bytes in one arena\n",
+                table.size(), table.categoryCount(), table.nameBytes());
+
+    // Same pipeline as cpp20_style, but the filter only reads the price column
+    auto prices = table.prices();
+    auto expensive_discounted = table.indices()
+        | std::views::filter([prices](std::size_t i) { return prices[i] > 100.0; })
+        | std::views::transform([&table](std::size_t i) {
+              return std::format("{} (${:.2f})", table.name(i), table.prices()[i] * 0.9);
+          });
+
+    std::println("Expensive products with discount:");
+    for (const auto& item : expensive_discounted) {
+        std::println("  {}", item);
+    }
+
+    // Category filter is an integer compare against a dictionary id
+    auto electronics = table.categoryId("Electronics").value_or(UINT32_MAX);
+    auto ids = table.categoryIds();
+    auto stocks = table.stocks();
+    double total = 0.0;
+    for (std::size_t i : table.indices()) {
+        if (ids[i] == electronics) total += prices[i] * stocks[i];
+    }
+    std::println("\nTotal electronics value: ${:.2f}", total);
+
+    // Row views work with the usual range adaptors
+    std::println("\nAffordable furniture:");
+    for (const auto& p : table.rows()
+            | std::views::filter([](const ProductRef& p) {
+                  return p.category == "Furniture" && p.price < 300.0;
+              })) {
+        std::println("  {}", p.name);
+    }
+
+    // chunk_by grouping sorts 4-byte row indices by integer category id
+    // instead of copying and string-comparing whole Product records
+    std::vector<std::size_t> order(table.size());
+    std::iota(order.begin(), order.end(), std::size_t{0});
+    std::ranges::stable_sort(order, {}, [ids](std::size_t i) { return ids[i]; });
+
+    std::println("\nProducts grouped by category:");
+    for (const auto& group : order | std::views::chunk_by(
+            [ids](std::size_t a, std::size_t b) { return ids[a] == ids[b]; })) {
+        std::println("  {}:", table.categoryName(ids[group.front()]));
+        for (std::size_t i : group) {
+            std::println("    - {}", table.name(i));
+        }
+    }
+
+    // Advantages over std::vector<Product>:
+    // - Scans touch only the columns they need
+    // - No allocation per name or category string
+    // - Category compares are integer compares
+    // - Columns are plain arrays, ready for SIMD kernels
+
+    std::println("");
+}
+
+} // namespace columnar
+
+// ============================================================================
+// Vectorized Style: SIMD kernels with selection vectors
+// ============================================================================
+
+namespace vectorized {
+
+// Instead of one lambda call per element, a filter becomes a kernel that
+// compares a block of the price column against a threshold and writes the
+// indices of passing rows into a selection vector. Later operators (the
+// discount, name lookup) then run over the selected rows only.
+//
+// Columns are processed in blocks of `vector_size` rows so the selection
+// vector and intermediate results stay in L1 cache.
+
+constexpr std::size_t vector_size = 2048;
+
+// For each 4-bit mask, a byte shuffle moving the 32-bit lanes whose bit is
+// set to the front (in order)
+constexpr auto compaction_shuffles = [] {
+    std::array<std::array<std::uint8_t, 16>, 16> table{};
+    for (unsigned mask = 0; mask < 16; ++mask) {
+        unsigned slot = 0;
+        for (unsigned lane = 0; lane < 4; ++lane) {
+            if (mask & (1u << lane)) {
+                for (unsigned byte = 0; byte < 4; ++byte) {
+                    table[mask][slot * 4 + byte] = static_cast<std::uint8_t>(lane * 4 + byte);
+                }
+                ++slot;
+            }
+        }
+        for (unsigned byte = slot * 4; byte < 16; ++byte) {
+            table[mask][byte] = 0x80;  // Zero the unused tail
+        }
+    }
+    return table;
+}();
+
+// Write the index of every row with column[i] > threshold to `selection`
+// (which must be at least column.size() long) and return how many matched
+std::size_t selectGreater(std::span<const double> column, double threshold,
+                          std::span<std::uint32_t> selection) {
+    if (selection.size() < column.size()) {
+        throw std::invalid_argument("Selection buffer is smaller than the column");
+    }
+    if (column.size() > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("Selection vectors use 32-bit row indices");
+    }
+
+    std::uint32_t* out = selection.data();
+    std::size_t count = 0;
+    std::size_t i = 0;
+
+#if defined(__AVX2__)
+    // Branchless compaction: the 4-bit compare mask selects a shuffle that
+    // packs the passing lane indices to the front. All four are stored,
+    // but the write cursor only advances by the number that passed.
+    const __m256d limit = _mm256_set1_pd(threshold);
+    for (; i + 4 <= column.size(); i += 4) {
+        __m256d values = _mm256_loadu_pd(column.data() + i);
+        auto mask = static_cast<unsigned>(
+            _mm256_movemask_pd(_mm256_cmp_pd(values, limit, _CMP_GT_OQ)));
+
+        __m128i lanes = _mm_add_epi32(_mm_set1_epi32(static_cast<int>(i)),
+                                      _mm_setr_epi32(0, 1, 2, 3));
+        __m128i packed = _mm_shuffle_epi8(lanes, _mm_loadu_si128(
+            reinterpret_cast<const __m128i*>(compaction_shuffles[mask].data())));
+        _mm_storeu_si128(reinterpret_cast<__m128i*>(out + count), packed);
+        count += std::popcount(mask);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    const float64x2_t limit = vdupq_n_f64(threshold);
+    for (; i + 2 <= column.size(); i += 2) {
+        uint64x2_t mask = vcgtq_f64(vld1q_f64(column.data() + i), limit);
+        out[count] = static_cast<std::uint32_t>(i);
+        count += vgetq_lane_u64(mask, 0) & 1;
+        out[count] = static_cast<std::uint32_t>(i + 1);
+        count += vgetq_lane_u64(mask, 1) & 1;
+    }
+#endif
+    // Branchless scalar fallback and tail: always write, conditionally advance
+    for (; i < column.size(); ++i) {
+        out[count] = static_cast<std::uint32_t>(i);
+        count += column[i] > threshold;
+    }
+
+    return count;
+}
+
+// out[k] = column[selection[k]] * factor
+//
+// Hardware gathers are rarely faster than scalar loads for doubles, so the
+// loads stay scalar; the compiler vectorizes the multiply and stores.
+void gatherScale(std::span<const double> column, std::span<const std::uint32_t> selection,
+                 double factor, std::span<double> out) {
+    if (out.size() < selection.size()) {
+        throw std::invalid_argument("Output is smaller than the selection");
+    }
+
+    for (std::size_t k = 0; k < selection.size(); ++k) {
+        out[k] = column[selection[k]] * factor;
+    }
+}
+
+// One block of the "expensive items with discount" scan: selected table
+// rows and their discounted prices, valid during the consumer call
+struct DiscountBatch {
+    std::span<const std::uint32_t> rows;
+    std::span<const double> prices;
+};
+
+template<typename Consumer>
+requires std::invocable<Consumer&, DiscountBatch>
+void scanDiscounted(const columnar::ProductTable& table, double threshold, double factor,
+                    Consumer&& consume) {
+    TRACE_SCOPE("vectorized scanDiscounted");
+    std::array<std::uint32_t, vector_size> selection;
+    std::array<double, vector_size> discounted;
+    auto prices = table.prices();
+
+    for (std::size_t offset = 0; offset < prices.size(); offset += vector_size) {
+        auto block = prices.subspan(offset, std::min(vector_size, prices.size() - offset));
+
+        std::size_t count = selectGreater(block, threshold, selection);
+        auto selected = std::span(selection).first(count);
+        gatherScale(block, selected, factor, discounted);
+
+        // Turn block-relative indices into table rows
+        for (auto& row : selected) row += static_cast<std::uint32_t>(offset);
+        consume(DiscountBatch{selected, std::span(discounted).first(count)});
+    }
+}
+
+void demo() {
+    std::println("=== Vectorized Style: Selection Vectors ===\n");
+
+    auto products = getProducts();
+    columnar::ProductTable table(products);
+
+    // Each batch plugs back into an ordinary view pipeline
+    std::println("Expensive products with discount:");
+    scanDiscounted(table, 100.0, 0.9, [&](DiscountBatch batch) {
+        auto items = std::views::iota(std::size_t{0}, batch.rows.size())
+            | std::views::transform([&](std::size_t k) {
+                  return std::format("{} (${:.2f})", table.name(batch.rows[k]), batch.prices[k]);
+              });
+        for (const auto& item : items) {
+            std::println("  {}", item);
+        }
+    });
+
+    // Scan comparison on a larger catalog
+    constexpr std::size_t rows = 1'000'000;
+    columnar::ProductTable big;
+    big.reserve(rows, rows * 8);
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> scale(0.0, 2.0);
+    for (std::size_t i = 0; i < rows; ++i) {
+        // Random prices make the filter outcome unpredictable, as in real data
+        const auto& p = products[i % products.size()];
+        big.push_back(p.name, p.price * scale(rng), p.category, p.stock);
+    }
+
+    using ms = std::chrono::duration<double, std::milli>;
+    auto prices = big.prices();
+
+    auto start = std::chrono::steady_clock::now();
+    double view_sum = 0.0;
+    std::size_t view_count = 0;
+    for (double price : big.indices()
+            | std::views::filter([prices](std::size_t i) { return prices[i] > 100.0; })
+            | std::views::transform([prices](std::size_t i) { return prices[i] * 0.9; })) {
+        view_sum += price;
+        ++view_count;
+    }
+    auto view_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    double kernel_sum = 0.0;
+    std::size_t kernel_count = 0;
+    scanDiscounted(big, 100.0, 0.9, [&](DiscountBatch batch) {
+        kernel_sum = std::accumulate(batch.prices.begin(), batch.prices.end(), kernel_sum);
+        kernel_count += batch.rows.size();
+    });
+    auto kernel_time = std::chrono::steady_clock::now() - start;
+
+    std::println("\nScan of {} rows ({} selected):", rows, kernel_count);
+    std::println("  filter | transform views:   {:.2f} ms", ms(view_time).count());
+    std::println("  select + gather kernels:    {:.2f} ms", ms(kernel_time).count());
+    std::println("  Same result: {}", view_count == kernel_count &&
+                                      std::abs(view_sum - kernel_sum) < 1e-9 * view_sum);
+
+    std::println("");
+}
+
+} // namespace vectorized
+
+// ============================================================================
+// Parallel Style: Chunked pipelines on a work-stealing thread pool
+// ============================================================================
+
+namespace parallel {
+
+// The input is split into fixed-size chunks (the same idea as
+// views::chunk), each chunk runs the serial pipeline, and the per-chunk
+// results are merged - in chunk order when the caller needs stable output.
+
+// Each worker owns a deque: it pushes and pops at the back (LIFO, cache
+// warm), idle workers steal from the front of other deques (FIFO, oldest
+// and typically largest work first).
+class ThreadPool {
+    using Task = std::function<void()>;
+
+    struct Queue {
+        std::mutex mutex;
+        std::deque<Task> tasks;
+    };
+
+    std::vector<std::unique_ptr<Queue>> queues_;
+    std::atomic<std::size_t> pending_{0};
+    std::atomic<std::size_t> next_queue_{0};
+    std::mutex sleep_mutex_;
+    std::condition_variable_any wake_;
+    std::vector<std::jthread> workers_;  // Last member: joined first on destruction
+
+    static inline thread_local std::size_t worker_index_ = SIZE_MAX;
+
+    std::optional<Task> popLocal(std::size_t index) {
+        auto& queue = *queues_[index];
+        std::lock_guard lock(queue.mutex);
+        if (queue.tasks.empty()) return std::nullopt;
+        Task task = std::move(queue.tasks.back());
+        queue.tasks.pop_back();
+        return task;
+    }
+
+    std::optional<Task> steal(std::size_t thief) {
+        for (std::size_t k = 1; k <= queues_.size(); ++k) {
+            auto& queue = *queues_[(thief + k) % queues_.size()];
+            std::unique_lock lock(queue.mutex, std::try_to_lock);
+            if (!lock || queue.tasks.empty()) continue;
+            Task task = std::move(queue.tasks.front());
+            queue.tasks.pop_front();
+            return task;
+        }
+        return std::nullopt;
+    }
+
+    void run(Task& task) {
+        pending_.fetch_sub(1, std::memory_order_relaxed);
+        task();
+    }
+
+    void workerLoop(std::stop_token stop, std::size_t index) {
+        worker_index_ = index;
+        while (!stop.stop_requested()) {
+            if (auto task = popLocal(index)) { run(*task); continue; }
+            if (auto task = steal(index)) { run(*task); continue; }
+
+            std::unique_lock lock(sleep_mutex_);
+            wake_.wait(lock, stop, [this] { return pending_.load() > 0; });
+        }
+    }
+
+public:
+    explicit ThreadPool(unsigned threads = std::max(1u, std::thread::hardware_concurrency())) {
+        for (unsigned i = 0; i < threads; ++i) {
+            queues_.push_back(std::make_unique<Queue>());
+        }
+        for (unsigned i = 0; i < threads; ++i) {
+            workers_.emplace_back([this, i](std::stop_token stop) { workerLoop(stop, i); });
+        }
+    }
+
+    ThreadPool(const ThreadPool&) = delete;
+    ThreadPool& operator=(const ThreadPool&) = delete;
+
+    ~ThreadPool() {
+        for (auto& worker : workers_) worker.request_stop();
+        wake_.notify_all();
+    }
+
+    std::size_t size() const { return workers_.size(); }
+
+    void submit(Task task) {
+        // Tasks spawned by a worker stay local; external ones are spread out
+        std::size_t index = worker_index_ < queues_.size()
+            ? worker_index_
+            : next_queue_.fetch_add(1, std::memory_order_relaxed) % queues_.size();
+        {
+            std::lock_guard lock(queues_[index]->mutex);
+            queues_[index]->tasks.push_back(std::move(task));
+        }
+        {
+            std::lock_guard lock(sleep_mutex_);
+            pending_.fetch_add(1, std::memory_order_relaxed);
+        }
+        wake_.notify_one();
+    }
+
+    // Run one queued task on the calling thread, if any. Used while waiting
+    // so that a caller (even a worker) helps instead of blocking.
+    bool runPendingTask() {
+        std::size_t self = worker_index_ < queues_.size() ? worker_index_ : 0;
+        auto task = worker_index_ < queues_.size() ? popLocal(self) : std::nullopt;
+        if (!task) task = steal(self);
+        if (!task) return false;
+        run(*task);
+        return true;
+    }
+};
+
+// Run fn(chunk_index, begin, end) for every chunk of [0, size) and wait.
+// Exceptions from chunks are rethrown on the calling thread.
+template<typename Fn>
+void forEachChunk(ThreadPool& pool, std::size_t size, std::size_t chunk_size, Fn&& fn) {
+    if (size == 0) return;
+    chunk_size = std::max<std::size_t>(1, chunk_size);
+    std::size_t chunks = (size + chunk_size - 1) / chunk_size;
+
+    std::atomic<std::size_t> remaining{chunks};
+    std::exception_ptr error;
+    std::mutex error_mutex;
+
+    for (std::size_t c = 0; c < chunks; ++c) {
+        pool.submit([&, c] {
+            TRACE_SCOPE("parallel chunk");
+            try {
+                std::size_t begin = c * chunk_size;
+                fn(c, begin, std::min(size, begin + chunk_size));
+            } catch (...) {
+                std::lock_guard lock(error_mutex);
+                if (!error) error = std::current_exception();
+            }
+            remaining.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    while (remaining.load(std::memory_order_acquire) > 0) {
+        if (!pool.runPendingTask()) std::this_thread::yield();
+    }
+    if (error) std::rethrow_exception(error);
+}
+
+constexpr std::size_t default_chunk = 16 * 1024;
+
+enum class Order { Preserve, Any };
+
+// Parallel `input | views::filter(pred) | views::transform(fn)`, materialized
+template<typename T, typename Pred, typename Fn>
+auto filterTransform(ThreadPool& pool, std::span<const T> input, Pred pred, Fn fn,
+                     Order order = Order::Preserve, std::size_t chunk_size = default_chunk) {
+    using R = std::invoke_result_t<Fn&, const T&>;
+    chunk_size = std::max<std::size_t>(chunk_size, 1);
+    std::size_t chunks = (input.size() + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<R>> partials(chunks);
+
+    std::vector<R> result;
+    std::mutex result_mutex;
+
+    forEachChunk(pool, input.size(), chunk_size, [&](std::size_t c, std::size_t b, std::size_t e) {
+        std::vector<R> local;
+        for (auto&& item : input.subspan(b, e - b)
+                | std::views::filter(pred) | std::views::transform(fn)) {
+            local.push_back(std::forward<decltype(item)>(item));
+        }
+        if (order == Order::Preserve) {
+            partials[c] = std::move(local);
+        } else {
+            std::lock_guard lock(result_mutex);
+            std::ranges::move(local, std::back_inserter(result));
+        }
+    });
+
+    if (order == Order::Preserve) {
+        std::size_t total = 0;
+        for (const auto& part : partials) total += part.size();
+        result.reserve(total);
+        for (auto& part : partials) std::ranges::move(part, std::back_inserter(result));
+    }
+    return result;
+}
+
+// Parallel std::accumulate / transform_reduce. Partials are combined in chunk
+// order, so floating-point results are deterministic for a given chunk size.
+template<typename T, typename Acc, typename Reduce, typename Fn>
+Acc transformReduce(ThreadPool& pool, std::span<const T> input, Acc init, Reduce reduce, Fn fn,
+                    std::size_t chunk_size = default_chunk) {
+    chunk_size = std::max<std::size_t>(chunk_size, 1);
+    std::size_t chunks = (input.size() + chunk_size - 1) / chunk_size;
+    std::vector<std::optional<Acc>> partials(chunks);
+
+    forEachChunk(pool, input.size(), chunk_size, [&](std::size_t c, std::size_t b, std::size_t e) {
+        auto chunk = input.subspan(b, e - b);
+        Acc acc = fn(chunk.front());
+        for (const T& item : chunk.subspan(1)) acc = reduce(std::move(acc), fn(item));
+        partials[c] = std::move(acc);
+    });
+
+    for (auto& part : partials) init = reduce(std::move(init), std::move(*part));
+    return init;
+}
+
+// Parallel stable sort: sort chunks independently, then merge neighbouring
+// runs pairwise, doubling the run width each round
+template<typename T, typename Comp = std::ranges::less, typename Proj = std::identity>
+void stableSort(ThreadPool& pool, std::span<T> data, Comp comp = {}, Proj proj = {},
+                std::size_t chunk_size = default_chunk) {
+    chunk_size = std::max<std::size_t>(chunk_size, 1);
+    auto less = [&](const T& a, const T& b) {
+        return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b));
+    };
+
+    forEachChunk(pool, data.size(), chunk_size, [&](std::size_t, std::size_t b, std::size_t e) {
+        std::stable_sort(data.begin() + b, data.begin() + e, less);
+    });
+
+    for (std::size_t width = chunk_size; width < data.size(); width *= 2) {
+        std::size_t pairs = (data.size() + 2 * width - 1) / (2 * width);
+        forEachChunk(pool, pairs, 1, [&](std::size_t, std::size_t p, std::size_t) {
+            std::size_t begin = p * 2 * width;
+            std::size_t middle = std::min(data.size(), begin + width);
+            std::size_t end = std::min(data.size(), begin + 2 * width);
+            std::inplace_merge(data.begin() + begin, data.begin() + middle, data.begin() + end, less);
+        });
+    }
+}
+
+void demo() {
+    std::println("=== Parallel Style: Work-Stealing Chunked Pipelines ===\n");
+
+    ThreadPool pool;
+    std::println("Thread pool with {} workers\n", pool.size());
+
+    auto base = getProducts();
+    std::vector<Product> products;
+    constexpr std::size_t copies = 100'000;
+    products.reserve(base.size() * copies);
+    for (std::size_t i = 0; i < copies; ++i) {
+        std::ranges::copy(base, std::back_inserter(products));
+    }
+    std::span<const Product> input(products);
+
+    using ms = std::chrono::duration<double, std::milli>;
+    auto time = [](auto&& fn) {
+        auto start = std::chrono::steady_clock::now();
+        auto result = fn();
+        return std::pair{result, ms(std::chrono::steady_clock::now() - start).count()};
+    };
+
+    // accumulate: total electronics value
+    auto electronics_value = [](const Product& p) {
+        return p.category == "Electronics" ? p.price * p.stock : 0.0;
+    };
+    auto [serial_total, serial_ms] = time([&] {
+        return std::accumulate(products.begin(), products.end(), 0.0,
+            [&](double sum, const Product& p) { return sum + electronics_value(p); });
+    });
+    auto [parallel_total, parallel_ms] = time([&] {
+        return transformReduce(pool, input, 0.0, std::plus{}, electronics_value);
+    });
+    std::println("Total electronics value over {} products:", products.size());
+    std::println("  serial:   ${:.2f} in {:.2f} ms", serial_total, serial_ms);
+    std::println("  parallel: ${:.2f} in {:.2f} ms", parallel_total, parallel_ms);
+
+    // filter | transform with order preserved
+    auto [names, filter_ms] = time([&] {
+        return filterTransform(pool, input,
+            [](const Product& p) { return p.price > 100.0; },
+            [](const Product& p) { return std::format("{} (${:.2f})", p.name, p.price * 0.9); });
+    });
+    std::println("\nExpensive products with discount: {} results in {:.2f} ms, first three:",
+                names.size(), filter_ms);
+    for (const auto& name : names | std::views::take(3)) {
+        std::println("  {}", name);
+    }
+
+    // sort + chunk_by group-by
+    auto sorted = products;
+    auto [ignored, sort_ms] = time([&] {
+        stableSort(pool, std::span(sorted), {}, &Product::category);
+        return 0;
+    });
+    std::println("\nParallel sort by category in {:.2f} ms:", sort_ms);
+    for (const auto& group : sorted | std::views::chunk_by(
+            [](const Product& a, const Product& b) { return a.category == b.category; })) {
+        std::println("  {}: {} products", group.front().category, std::ranges::distance(group));
+    }
+
+    std::println("");
+}
+
+} // namespace parallel
+
+// ============================================================================
+// Aggregation: Single-pass hash group-by
+// ============================================================================
+
+namespace aggregation {
+
+// Replaces "copy, sort by key, chunk_by": one pass over the input, no copy
+// and no reordering, O(n) expected instead of O(n log n).
+
+struct Aggregate {
+    std::size_t count = 0;
+    double sum = 0.0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+
+    void add(double value) {
+        ++count;
+        sum += value;
+        min = std::min(min, value);
+        max = std::max(max, value);
+    }
+
+    void merge(const Aggregate& other) {
+        count += other.count;
+        sum += other.sum;
+        min = std::min(min, other.min);
+        max = std::max(max, other.max);
+    }
+
+    double avg() const { return count ? sum / static_cast<double>(count) : 0.0; }
+};
+
+// String keys are stored as views into the input (which must outlive the
+// result) when the input's elements stay put; other key types, and keys
+// from temporary containers or from ranges that yield temporaries or reuse
+// their storage, are stored by value
+template<typename Projected, bool StableInput = true>
+using GroupKey = std::conditional_t<
+    StableInput &&
+        std::is_convertible_v<Projected, std::string_view> &&
+        std::is_lvalue_reference_v<Projected>,
+    std::string_view,
+    std::remove_cvref_t<Projected>>;
+
+template<typename KeyProj, typename T, bool StableInput = true>
+using GroupMap = std::unordered_map<
+    GroupKey<std::invoke_result_t<KeyProj&, const T&>, StableInput>, Aggregate>;
+
+template<std::ranges::input_range R, typename KeyProj, typename ValueProj>
+auto groupAggregate(R&& input, KeyProj key, ValueProj value) {
+    constexpr bool stable = (std::is_lvalue_reference_v<R> || std::ranges::borrowed_range<R>) &&
+                            std::ranges::forward_range<R> &&
+                            std::is_lvalue_reference_v<std::ranges::range_reference_t<R>>;
+    GroupMap<KeyProj, std::ranges::range_value_t<R>, stable> groups;
+    for (const auto& item : input) {
+        groups[std::invoke(key, item)].add(std::invoke(value, item));
+    }
+    return groups;
+}
+
+// Partitioned parallel version:
+//  1. each chunk aggregates into `partitions` local maps, split by key hash
+//  2. each partition is merged across chunks independently
+// No locks in either phase, and no key is ever merged by two threads.
+template<typename T, typename KeyProj, typename ValueProj>
+auto groupAggregate(parallel::ThreadPool& pool, std::span<const T> input,
+                    KeyProj key, ValueProj value,
+                    std::size_t chunk_size = parallel::default_chunk) {
+    using Map = GroupMap<KeyProj, T>;
+    using Key = typename Map::key_type;
+
+    chunk_size = std::max<std::size_t>(chunk_size, 1);
+    std::size_t partitions = pool.size();
+    std::size_t chunks = (input.size() + chunk_size - 1) / chunk_size;
+    std::vector<std::vector<Map>> local(chunks, std::vector<Map>(partitions));
+
+    parallel::forEachChunk(pool, input.size(), chunk_size,
+        [&](std::size_t c, std::size_t b, std::size_t e) {
+            for (const T& item : input.subspan(b, e - b)) {
+                Key k = std::invoke(key, item);
+                std::size_t p = std::hash<Key>{}(k) % partitions;
+                local[c][p][k].add(std::invoke(value, item));
+            }
+        });
+
+    std::vector<Map> merged(partitions);
+    parallel::forEachChunk(pool, partitions, 1, [&](std::size_t p, std::size_t, std::size_t) {
+        for (auto& chunk : local) {
+            for (const auto& [k, agg] : chunk[p]) merged[p][k].merge(agg);
+        }
+    });
+
+    Map result;
+    for (auto& part : merged) result.merge(part);  // Disjoint keys: splices nodes
+    return result;
+}
+
+template<typename Map>
+void printGroups(const Map& groups) {
+    std::vector<typename Map::key_type> keys;
+    for (const auto& [k, agg] : groups) keys.push_back(k);
+    std::ranges::sort(keys);  // Display order only; the operator doesn't sort
+
+    std::println("  {:<12} {:>9} {:>14} {:>9} {:>9} {:>9}",
+                "category", "count", "sum", "min", "max", "avg");
+    for (const auto& k : keys) {
+        const auto& agg = groups.at(k);
+        std::println("  {:<12} {:>9} {:>14.2f} {:>9.2f} {:>9.2f} {:>9.2f}",
+                    k, agg.count, agg.sum, agg.min, agg.max, agg.avg());
+    }
+}
+
+void demo() {
+    std::println("=== Aggregation: Hash Group-By ===\n");
+
+    const auto products = getProducts();
+
+    std::println("Price statistics per category (input untouched):");
+    printGroups(groupAggregate(products, &Product::category, &Product::price));
+
+    // A view that yields temporaries: its keys are copied into std::string
+    auto discounted = products | std::views::transform([](Product p) {
+        p.price *= 0.9;
+        return p;
+    });
+    auto discounted_groups = groupAggregate(discounted, &Product::category, &Product::price);
+    static_assert(std::same_as<decltype(discounted_groups)::key_type, std::string>);
+    std::println("After a 10% discount:");
+    printGroups(discounted_groups);
+
+    // A temporary container is gone when the call returns: keys are copied too
+    auto fresh_groups = groupAggregate(getProducts(), &Product::category, &Product::price);
+    static_assert(std::same_as<decltype(fresh_groups)::key_type, std::string>);
+    static_assert(std::same_as<decltype(groupAggregate(products, &Product::category, &Product::price))::key_type,
+                               std::string_view>);
+    std::println("From a freshly loaded catalog: {} categories", fresh_groups.size());
+
+    // Larger input: compare with the copy + sort + chunk_by approach
+    std::vector<Product> many;
+    constexpr std::size_t copies = 100'000;
+    many.reserve(products.size() * copies);
+    for (std::size_t i = 0; i < copies; ++i) {
+        std::ranges::copy(products, std::back_inserter(many));
+    }
+
+    using ms = std::chrono::duration<double, std::milli>;
+
+    auto start = std::chrono::steady_clock::now();
+    auto sorted = many;
+    std::ranges::sort(sorted, {}, &Product::category);
+    std::size_t groups_by_sort = 0;
+    for (const auto& group : sorted | std::views::chunk_by(
+            [](const Product& a, const Product& b) { return a.category == b.category; })) {
+        Aggregate agg;
+        for (const auto& p : group) agg.add(p.price);
+        groups_by_sort += agg.count > 0;
+    }
+    auto sort_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    auto hashed = groupAggregate(many, &Product::category, &Product::price);
+    auto hash_time = std::chrono::steady_clock::now() - start;
+
+    parallel::ThreadPool pool;
+    start = std::chrono::steady_clock::now();
+    auto partitioned = groupAggregate(pool, std::span<const Product>(many),
+                                      &Product::category, &Product::price);
+    auto parallel_time = std::chrono::steady_clock::now() - start;
+
+    std::println("\nGrouping {} products:", many.size());
+    std::println("  copy + sort + chunk_by: {} groups in {:.2f} ms",
+                groups_by_sort, ms(sort_time).count());
+    std::println("  hash aggregation:       {} groups in {:.2f} ms",
+                hashed.size(), ms(hash_time).count());
+    std::println("  partitioned parallel:   {} groups in {:.2f} ms ({} workers)",
+                partitioned.size(), ms(parallel_time).count(), pool.size());
+    std::println("  Same electronics count: {}",
+                hashed.at("Electronics").count == partitioned.at("Electronics").count);
+
+    std::println("");
+}
+
+} // namespace aggregation
+
+// ============================================================================
+// Ranking: Top-K with a bounded heap
+// ============================================================================
+
+namespace ranking {
+
+// "Top N by price" without sorting (or even materializing) the full result:
+// one pass over the input keeps the best k candidates in a heap whose top
+// is the weakest of them, so most elements cost a single comparison.
+//
+// comp(a, b) means "a ranks before b"; the default std::ranges::greater
+// ranks by descending projection.
+
+template<std::ranges::input_range R,
+         typename Comp = std::ranges::greater, typename Proj = std::identity>
+auto topK(R&& input, std::size_t k, Comp comp = {}, Proj proj = {}) {
+    using Value = std::ranges::range_value_t<R>;
+    using Reference = std::ranges::range_reference_t<R>;
+
+    std::vector<Value> result;
+    if (k == 0) return result;
+
+    auto ranks_before = [&](const Value& a, const Value& b) {
+        return std::invoke(comp, std::invoke(proj, a), std::invoke(proj, b));
+    };
+
+    // Fallback: when k covers most of a sized input the heap prunes little,
+    // so a partial sort of a copy is cheaper
+    if constexpr (std::ranges::sized_range<R>) {
+        auto n = static_cast<std::size_t>(std::ranges::size(input));
+        if (k >= n / 2) {
+            result.assign(std::ranges::begin(input), std::ranges::end(input));
+            auto middle = result.begin() + static_cast<std::ptrdiff_t>(std::min(k, n));
+            std::partial_sort(result.begin(), middle, result.end(), ranks_before);
+            result.erase(middle, result.end());
+            return result;
+        }
+    }
+
+    if constexpr (std::ranges::forward_range<R> && std::is_lvalue_reference_v<Reference>) {
+        // Elements live in the underlying container: heap over pointers and
+        // copy only the k winners at the end. Single-pass ranges are
+        // excluded: istream_view, say, reuses one element for every read.
+        using Pointer = std::add_pointer_t<std::remove_reference_t<Reference>>;
+        auto ptr_before = [&](Pointer a, Pointer b) { return ranks_before(*a, *b); };
+
+        std::vector<Pointer> heap;
+        heap.reserve(k);
+        for (auto&& item : input) {
+            if (heap.size() < k) {
+                heap.push_back(std::addressof(item));
+                std::ranges::push_heap(heap, ptr_before);
+            } else if (ranks_before(item, *heap.front())) {
+                std::ranges::pop_heap(heap, ptr_before);
+                heap.back() = std::addressof(item);
+                std::ranges::push_heap(heap, ptr_before);
+            }
+        }
+        std::ranges::sort_heap(heap, ptr_before);
+
+        result.reserve(heap.size());
+        for (Pointer p : heap) result.push_back(*p);
+    } else {
+        // Elements are computed on the fly (e.g. by views::transform) or
+        // do not outlive the iteration that produced them
+        result.reserve(k);
+        for (auto&& item : input) {
+            if (result.size() < k) {
+                result.push_back(std::forward<decltype(item)>(item));
+                std::ranges::push_heap(result, ranks_before);
+            } else if (ranks_before(item, result.front())) {
+                std::ranges::pop_heap(result, ranks_before);
+                result.back() = std::forward<decltype(item)>(item);
+                std::ranges::push_heap(result, ranks_before);
+            }
+        }
+        std::ranges::sort_heap(result, ranks_before);
+    }
+    return result;
+}
+
+// Pipeable form: products | views::filter(...) | ranking::top(3, &Product::price)
+template<typename Comp, typename Proj>
+struct TopClosure {
+    std::size_t k;
+    Comp comp;
+    Proj proj;
+
+    template<std::ranges::input_range R>
+    friend auto operator|(R&& input, const TopClosure& self) {
+        return topK(std::forward<R>(input), self.k, self.comp, self.proj);
+    }
+};
+
+template<typename Proj = std::identity, typename Comp = std::ranges::greater>
+TopClosure<Comp, Proj> top(std::size_t k, Proj proj = {}, Comp comp = {}) {
+    return {k, comp, proj};
+}
+
+void demo() {
+    std::println("=== Ranking: Top-K Operator ===\n");
+
+    auto products = getProducts();
+
+    // Composes with the existing filter views
+    auto expensive = products
+        | std::views::filter([](const Product& p) { return p.price > 100.0; });
+
+    std::println("Top 3 expensive items by price:");
+    auto podium = expensive | top(3, &Product::price);
+    for (std::size_t rank = 0; rank < podium.size(); ++rank) {
+        std::println("  #{}: {} (${:.2f})", rank + 1, podium[rank].name, podium[rank].price);
+    }
+
+    // Works on computed elements too
+    auto stock_value = products
+        | std::views::transform([](const Product& p) {
+              return std::pair{p.name, p.price * p.stock};
+          });
+
+    std::println("\nTop 3 by stock value:");
+    for (const auto& [name, value] : topK(stock_value, 3, {}, &std::pair<std::string, double>::second)) {
+        std::println("  {}: ${:.2f}", name, value);
+    }
+
+    // Single-pass input: istream_view yields one reused element, so the
+    // winners are copied as they are seen
+    std::istringstream readings("12.5 99.0 3.25 47.75 88.0");
+    std::print("\nTop 2 readings from a stream:");
+    for (double reading : topK(std::views::istream<double>(readings), 2)) {
+        std::print(" {}", reading);
+    }
+    std::println("");
+
+    std::println("\nCheapest 2 (custom comparator):");
+    for (const auto& p : products | top(2, &Product::price, std::ranges::less{})) {
+        std::println("  {} (${:.2f})", p.name, p.price);
+    }
+
+    // Large input: heap vs full sort
+    std::vector<Product> many;
+    std::mt19937 rng(7);
+    std::uniform_real_distribution<double> price(1.0, 1000.0);
+    for (std::size_t i = 0; i < 1'000'000; ++i) {
+        const auto& p = products[i % products.size()];
+        many.push_back({p.name, price(rng), p.category, p.stock});
+    }
+
+    using ms = std::chrono::duration<double, std::milli>;
+    auto start = std::chrono::steady_clock::now();
+    auto best = many | std::views::filter([](const Product& p) { return p.price > 100.0; })
+                     | top(10, &Product::price);
+    auto heap_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    std::vector<Product> all;
+    std::ranges::copy_if(many, std::back_inserter(all), [](const Product& p) { return p.price > 100.0; });
+    std::ranges::sort(all, std::ranges::greater{}, &Product::price);
+    auto sort_time = std::chrono::steady_clock::now() - start;
+
+    std::println("\nTop 10 of {} products:", many.size());
+    std::println("  bounded heap:          {:.2f} ms", ms(heap_time).count());
+    std::println("  materialize + sort:    {:.2f} ms", ms(sort_time).count());
+    std::println("  Same best price: {}", best.front().price == all.front().price);
+
+    std::println("");
+}
+
+} // namespace ranking
+
+// ============================================================================
+// Ingestion: Streaming product readers with reusable columnar batches
+// ============================================================================
+
+namespace ingestion {
+
+// getProducts() materializes the whole catalog before any pipeline runs.
+// The readers here parse a stream into a columnar::ProductTable batch that
+// is cleared and refilled, so memory stays at one batch no matter how large
+// the input is, and a lazy consumer that stops early stops the reading too.
+//
+// Every reader has the same shape:
+//   bool next(columnar::ProductTable& batch, std::size_t max_rows)
+// which replaces the batch contents and returns false once the input is done.
+
+// Text format, one product per line: name,price,category,stock
+class CsvProductReader {
+    std::istream& in_;
+    std::string line_;  // Reused for every line
+    std::size_t line_number_ = 0;
+
+    [[noreturn]] void fail(std::string_view what) const {
+        throw std::runtime_error(std::format("CSV line {}: {}", line_number_, what));
+    }
+
+    template<typename Number>
+    Number parseNumber(std::string_view field) const {
+        Number value{};
+        auto [ptr, ec] = std::from_chars(field.data(), field.data() + field.size(), value);
+        if (ec != std::errc{} || ptr != field.data() + field.size()) {
+            fail(std::format("invalid number '{}'", field));
+        }
+        return value;
+    }
+
+public:
+    explicit CsvProductReader(std::istream& in) : in_(in) {}
+
+    bool next(columnar::ProductTable& batch, std::size_t max_rows) {
+        batch.clear();
+        while (batch.size() < max_rows && std::getline(in_, line_)) {
+            ++line_number_;
+            std::string_view rest = line_;
+            if (!rest.empty() && rest.back() == '\r') rest.remove_suffix(1);
+            if (rest.empty()) continue;
+
+            std::array<std::string_view, 4> fields;
+            for (std::size_t f = 0; f < fields.size(); ++f) {
+                auto comma = rest.find(',');
+                if ((comma == std::string_view::npos) != (f == fields.size() - 1)) {
+                    fail("expected 4 comma-separated fields");
+                }
+                fields[f] = rest.substr(0, comma);
+                rest.remove_prefix(comma == std::string_view::npos ? rest.size() : comma + 1);
+            }
+
+            batch.push_back(fields[0], parseNumber<double>(fields[1]),
+                            fields[2], parseNumber<int>(fields[3]));
+        }
+        return !batch.empty();
+    }
+};
+
+// Binary format, per product (native byte order):
+//   u32 name length, name bytes, f64 price, u32 category length, category bytes, i32 stock
+inline void writeBinary(std::ostream& out, std::span<const Product> products) {
+    auto put = [&out](const auto& value) {
+        out.write(reinterpret_cast<const char*>(&value), sizeof(value));
+    };
+    auto putString = [&](const std::string& s) {
+        put(static_cast<std::uint32_t>(s.size()));
+        out.write(s.data(), static_cast<std::streamsize>(s.size()));
+    };
+
+    for (const auto& p : products) {
+        putString(p.name);
+        put(p.price);
+        putString(p.category);
+        put(p.stock);
+    }
+}
+
+class BinaryProductReader {
+    std::istream& in_;
+    std::string name_;      // Reused field buffers
+    std::string category_;
+
+    template<typename T>
+    bool get(T& value) {
+        return static_cast<bool>(in_.read(reinterpret_cast<char*>(&value), sizeof(value)));
+    }
+
+    [[noreturn]] static void truncated() {
+        throw std::runtime_error("Truncated binary product record");
+    }
+
+    // False only at a clean end of input, before any byte of the length
+    // prefix; a record cut short anywhere after that throws
+    bool getString(std::string& s) {
+        std::uint32_t length = 0;
+        if (!get(length)) {
+            if (in_.gcount() == 0) return false;
+            truncated();
+        }
+        if (length > max_field_size) {
+            throw std::runtime_error(std::format("Binary product field of {} bytes exceeds the {}-byte limit",
+                                                 length, max_field_size));
+        }
+        s.resize(length);
+        if (!in_.read(s.data(), length)) truncated();
+        return true;
+    }
+
+public:
+    // Lengths come from the input, so a corrupt one must not size a buffer
+    static constexpr std::uint32_t max_field_size = 1 << 20;
+
+    explicit BinaryProductReader(std::istream& in) : in_(in) {}
+
+    bool next(columnar::ProductTable& batch, std::size_t max_rows) {
+        batch.clear();
+        while (batch.size() < max_rows) {
+            double price = 0.0;
+            int stock = 0;
+            if (!getString(name_)) break;  // Clean end of input
+            if (!get(price) || !getString(category_) || !get(stock)) truncated();
+            batch.push_back(name_, price, category_, stock);
+        }
+        return !batch.empty();
+    }
+};
+
+template<typename Reader>
+concept ProductReader = requires(Reader& reader, columnar::ProductTable& batch, std::size_t n) {
+    { reader.next(batch, n) } -> std::same_as<bool>;
+};
+
+// Hand each batch to fn(const columnar::ProductTable&), e.g. a vectorized scan
+template<ProductReader Reader, typename Fn>
+requires std::invocable<Fn&, const columnar::ProductTable&>
+void forEachBatch(Reader& reader, std::size_t batch_rows, Fn&& fn) {
+    columnar::ProductTable batch;
+    batch.reserve(batch_rows);
+    while (reader.next(batch, batch_rows)) {
+        fn(std::as_const(batch));
+    }
+}
+
+// Row-at-a-time input range over a reader. Batches are fetched on demand,
+// so `stream | views::take(3)` reads a single batch. The ProductRefs point
+// into the current batch and are only valid until the iterator advances
+// past it: copy what must outlive the loop.
+template<ProductReader Reader>
+class ProductStream {
+    Reader reader_;
+    columnar::ProductTable batch_;
+    std::size_t batch_rows_;
+    std::size_t row_ = 0;
+    std::size_t batches_read_ = 0;
+    bool done_ = false;
+
+    void refill() {
+        row_ = 0;
+        if (reader_.next(batch_, batch_rows_)) {
+            ++batches_read_;
+        } else {
+            done_ = true;
+        }
+    }
+
+public:
+    class iterator {
+        ProductStream* stream_ = nullptr;
+
+    public:
+        using value_type = columnar::ProductRef;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        explicit iterator(ProductStream& stream) : stream_(&stream) {}
+
+        columnar::ProductRef operator*() const { return stream_->batch_.row(stream_->row_); }
+
+        iterator& operator++() {
+            if (++stream_->row_ == stream_->batch_.size()) stream_->refill();
+            return *this;
+        }
+        void operator++(int) { ++*this; }
+
+        bool operator==(std::default_sentinel_t) const { return stream_->done_; }
+    };
+
+    template<typename... Args>
+    explicit ProductStream(std::size_t batch_rows, Args&&... reader_args)
+        : reader_(std::forward<Args>(reader_args)...), batch_rows_(batch_rows) {
+        if (batch_rows_ == 0) throw std::invalid_argument("ProductStream batch size must be positive");
+        batch_.reserve(batch_rows_);
+    }
+
+    ProductStream(const ProductStream&) = delete;
+    ProductStream& operator=(const ProductStream&) = delete;
+
+    // Single pass: the first call starts reading
+    iterator begin() {
+        if (batches_read_ == 0 && !done_) refill();
+        return iterator(*this);
+    }
+    std::default_sentinel_t end() const { return {}; }
+
+    std::size_t batchesRead() const { return batches_read_; }
+};
+
+void demo() {
+    std::println("=== Ingestion: Streaming Readers ===\n");
+
+    auto products = getProducts();
+
+    // A large CSV "file"; any std::istream works (std::ifstream in practice)
+    constexpr std::size_t copies = 50'000;
+    std::string csv;
+    for (std::size_t i = 0; i < copies; ++i) {
+        for (const auto& p : products) {
+            std::format_to(std::back_inserter(csv), "{},{},{},{}\n", p.name, p.price, p.category, p.stock);
+        }
+    }
+    std::size_t total_rows = copies * products.size();
+
+    // Early exit: take(3) stops after the first batch
+    {
+        std::istringstream in(csv);
+        ProductStream<CsvProductReader> stream(4096, in);
+
+        std::println("First 3 expensive products from {} CSV rows:", total_rows);
+        for (const auto& p : stream
+                | std::views::filter([](const columnar::ProductRef& p) { return p.price > 100.0; })
+                | std::views::take(3)) {
+            std::println("  {} (${:.2f})", p.name, p.price * 0.9);
+        }
+        std::println("  Batches read: {}", stream.batchesRead());
+    }
+
+    // Full scan, batch at a time, through the vectorized kernel.
+    // Peak memory is one 4096-row batch, not the whole catalog.
+    {
+        std::istringstream in(csv);
+        CsvProductReader reader(in);
+        std::size_t batches = 0;
+        std::size_t selected = 0;
+        double discounted_total = 0.0;
+
+        forEachBatch(reader, 4096, [&](const columnar::ProductTable& batch) {
+            ++batches;
+            vectorized::scanDiscounted(batch, 100.0, 0.9, [&](vectorized::DiscountBatch hits) {
+                selected += hits.rows.size();
+                discounted_total = std::accumulate(hits.prices.begin(), hits.prices.end(),
+                                                   discounted_total);
+            });
+        });
+        std::println("\nStreamed {} batches: {} expensive rows, ${:.2f} after discount",
+                    batches, selected, discounted_total);
+    }
+
+    // Binary records round-trip through the same stream interface
+    {
+        std::stringstream binary(std::ios::in | std::ios::out | std::ios::binary);
+        writeBinary(binary, products);
+
+        ProductStream<BinaryProductReader> stream(4, binary);
+        std::println("\nFurniture from binary input:");
+        for (const auto& p : stream
+                | std::views::filter([](const columnar::ProductRef& p) { return p.category == "Furniture"; })) {
+            std::println("  {} ({} in stock)", p.name, p.stock);
+        }
+        std::println("  Batches read: {}", stream.batchesRead());
+    }
+
+    // Malformed input reports the line
+    {
+        std::istringstream in("Laptop,999.99,Electronics,5\nMouse,cheap,Electronics,50\n");
+        CsvProductReader reader(in);
+        columnar::ProductTable batch;
+        try {
+            reader.next(batch, 16);
+        } catch (const std::runtime_error& e) {
+            std::println("\nError: {}", e.what());
+        }
+    }
+
+    // A binary record cut off right after a length prefix is truncated, not
+    // the end of input
+    {
+        std::stringstream binary(std::ios::in | std::ios::out | std::ios::binary);
+        writeBinary(binary, std::span(products).first(1));
+        std::uint32_t dangling_length = 6;
+        binary.write(reinterpret_cast<const char*>(&dangling_length), sizeof(dangling_length));
+
+        BinaryProductReader reader(binary);
+        columnar::ProductTable batch;
+        try {
+            reader.next(batch, 16);
+        } catch (const std::runtime_error& e) {
+            std::println("Error: {}", e.what());
+        }
+    }
+
+    std::println("");
+}
+
+} // namespace ingestion
+
+// ============================================================================
+// PMR Style: One memory resource per pipeline run
+// ============================================================================
+
+namespace pmr_style {
+
+// Allocator-aware Product: both strings allocate from the resource the
+// Product was built with, and pmr containers hand theirs down to every
+// element (uses-allocator construction), so one monotonic_buffer_resource
+// can back a whole pipeline and be released in one shot.
+struct Product {
+    using allocator_type = std::pmr::polymorphic_allocator<>;
+
+    std::pmr::string name;
+    double price = 0.0;
+    std::pmr::string category;
+    int stock = 0;
+
+    explicit Product(allocator_type alloc = {}) : name(alloc), category(alloc) {}
+
+    Product(std::string_view name, double price, std::string_view category, int stock,
+            allocator_type alloc = {})
+        : name(name, alloc), price(price), category(category, alloc), stock(stock) {}
+
+    // From the std::allocator version
+    Product(const ::Product& p, allocator_type alloc = {})
+        : Product(p.name, p.price, p.category, p.stock, alloc) {}
+
+    Product(const Product& other, allocator_type alloc = {})
+        : name(other.name, alloc), price(other.price), category(other.category, alloc),
+          stock(other.stock) {}
+
+    Product(Product&& other) noexcept = default;
+    Product(Product&& other, allocator_type alloc)
+        : name(std::move(other.name), alloc), price(other.price),
+          category(std::move(other.category), alloc), stock(other.stock) {}
+
+    Product& operator=(const Product&) = default;
+    Product& operator=(Product&&) = default;
+
+    allocator_type get_allocator() const { return name.get_allocator(); }
+};
+
+std::pmr::vector<Product> loadProducts(std::span<const ::Product> source,
+                                       std::pmr::memory_resource* resource) {
+    std::pmr::vector<Product> products(resource);
+    products.reserve(source.size());
+    for (const auto& p : source) {
+        products.emplace_back(p);  // Strings land in `resource`
+    }
+    return products;
+}
+
+// The cpp11/cpp17 task with every container and string in `resource`.
+// Text is formatted straight into the pmr::string, with the same "%f"
+// formatting std::to_string uses.
+std::pmr::vector<std::pmr::string> expensiveWithDiscount(const std::pmr::vector<Product>& products,
+                                                         std::pmr::memory_resource* resource) {
+    TRACE_SCOPE("pmr expensiveWithDiscount");
+    std::pmr::vector<std::pmr::string> result(resource);
+    for (const auto& p : products | std::views::filter([](const Product& p) { return p.price > 100.0; })) {
+        auto& item = result.emplace_back();
+        std::format_to(std::back_inserter(item), "{} (${:.6f})", p.name, p.price * 0.9);
+    }
+    return result;
+}
+
+void demo() {
+    std::println("=== PMR Style: Pipeline Arenas ===\n");
+
+    auto source = getProducts();
+
+    // A whole request on a stack buffer; the null upstream would throw if
+    // anything spilled to the heap
+    {
+        std::array<std::byte, 8192> buffer;
+        std::pmr::monotonic_buffer_resource request(buffer.data(), buffer.size(),
+                                                    std::pmr::null_memory_resource());
+
+        alloc::Scope scope;
+        auto products = loadProducts(source, &request);
+        auto result = expensiveWithDiscount(products, &request);
+        auto stats = scope.stats();
+
+        std::println("Expensive products with discount:");
+        for (const auto& item : result) {
+            std::println("  {}", item);
+        }
+        std::println("Heap allocations for the whole pipeline: {}", stats.count);
+    }  // Arena released: no per-element destructor frees anything
+
+    // Same output as the std::allocator pipelines
+    {
+        std::pmr::monotonic_buffer_resource request;
+        auto result = expensiveWithDiscount(loadProducts(source, &request), &request);
+        auto reference = cpp11_style::expensiveWithDiscount(source);
+        std::println("\nMatches cpp11_style output: {}",
+                     std::ranges::equal(result, reference,
+                         [](std::string_view a, std::string_view b) { return a == b; }));
+    }
+
+    // Repeated requests: default heap vs an arena over reused scratch memory
+    bench::Suite suite("example2.pmr_pipeline");
+    for (std::size_t size : {10uz, 1'000uz, 100'000uz}) {
+        std::vector<::Product> catalog;
+        catalog.reserve(size);
+        for (std::size_t i = 0; i < size; ++i) catalog.push_back(source[i % source.size()]);
+
+        suite.run("default heap (load + pipeline)", size, [&] {
+            auto* heap = std::pmr::new_delete_resource();
+            return expensiveWithDiscount(loadProducts(catalog, heap), heap).size();
+        });
+
+        std::vector<std::byte> scratch(size * 256);  // Sized for one request
+        suite.run("monotonic arena (load + pipeline)", size, [&] {
+            std::pmr::monotonic_buffer_resource request(scratch.data(), scratch.size());
+            return expensiveWithDiscount(loadProducts(catalog, &request), &request).size();
+        });
+    }
+    suite.report();
+
+    std::println("");
+}
+
+} // namespace pmr_style
+
 // ============================================================================
 // Performance Comparison
 // ============================================================================
 
 namespace performance {
 
+// Same tasks in every style, timed at several catalog sizes
+std::vector<Product> makeCatalog(std::size_t size) {
+    auto base = getProducts();
+    std::vector<Product> catalog;
+    catalog.reserve(size);
+    for (std::size_t i = 0; i < size; ++i) {
+        catalog.push_back(base[i % base.size()]);
+    }
+    return catalog;
+}
+
+// Consume a range of strings so the benchmark keeps the work
+template<std::ranges::input_range R>
+std::size_t totalLength(R&& strings) {
+    std::size_t total = 0;
+    for (const auto& s : strings) total += s.size();
+    return total;
+}
+
+void benchmarkPipelines() {
+    bench::Suite suite("example2.expensive_with_discount");
+    bench::Suite totals("example2.electronics_value");
+    bench::Suite first3("example2.first_3_expensive");
+
+    for (std::size_t size : {10uz, 1'000uz, 100'000uz}) {
+        auto products = makeCatalog(size);
+        columnar::ProductTable table(products);
+
+        suite.run("cpp11 manual loops", size, [&] {
+            return totalLength(cpp11_style::expensiveWithDiscount(products));
+        });
+        suite.run("cpp17 copy_if + transform", size, [&] {
+            return totalLength(cpp17_style::expensiveWithDiscount(products));
+        });
+        suite.run("cpp20 filter | transform", size, [&] {
+            return totalLength(cpp20_style::expensiveWithDiscount(products));
+        });
+
+        totals.run("cpp11 manual loop", size, [&] { return cpp11_style::electronicsValue(products); });
+        totals.run("cpp17 accumulate", size, [&] { return cpp17_style::electronicsValue(products); });
+        totals.run("cpp20 filter | transform", size, [&] {
+            double total = 0.0;
+            for (double value : cpp20_style::electronicsValues(products)) total += value;
+            return total;
+        });
+        totals.run("columnar dictionary ids", size, [&] {
+            auto electronics = table.categoryId("Electronics").value_or(UINT32_MAX);
+            auto ids = table.categoryIds();
+            auto prices = table.prices();
+            auto stocks = table.stocks();
+            double total = 0.0;
+            for (std::size_t i = 0; i < table.size(); ++i) {
+                if (ids[i] == electronics) total += prices[i] * stocks[i];
+            }
+            return total;
+        });
+
+        // Only the lazy pipeline can stop early
+        first3.run("cpp11 loops, then first 3", size, [&] {
+            auto all = cpp11_style::expensiveWithDiscount(products);
+            all.resize(std::min<std::size_t>(all.size(), 3));
+            return totalLength(all);
+        });
+        first3.run("cpp20 views | take(3)", size, [&] {
+            return totalLength(cpp20_style::expensiveWithDiscount(products) | std::views::take(3));
+        });
+    }
+
+    suite.report();
+    std::println("");
+    totals.report();
+    std::println("");
+    first3.report();
+}
+
+// One run of each pipeline. The peak column shows intermediate containers
+// that allocation totals hide: cpp17's copy of every expensive Product is
+// alive at the same time as the result vector.
+void reportPipelineAllocations() {
+    auto products = makeCatalog(1'000);
+    std::size_t characters = 0;
+
+    std::println("Allocations per pipeline run ({} products):", products.size());
+    {
+        alloc::Report report("cpp11 manual loops");
+        characters += totalLength(cpp11_style::expensiveWithDiscount(products));
+    }
+    {
+        alloc::Report report("cpp17 copy_if + transform");
+        characters += totalLength(cpp17_style::expensiveWithDiscount(products));
+    }
+    {
+        alloc::Report report("cpp20 filter | transform");
+        characters += totalLength(cpp20_style::expensiveWithDiscount(products));
+    }
+    {
+        alloc::Report report("cpp20 views | take(3)");
+        characters += totalLength(cpp20_style::expensiveWithDiscount(products) | std::views::take(3));
+    }
+
+    // Keeping the results: a monotonic arena takes a few large blocks from
+    // upstream instead of one heap allocation per stored string
+    {
+        alloc::CountingResource upstream;
+        std::pmr::monotonic_buffer_resource arena(64 * 1024, &upstream);
+        std::pmr::vector<std::pmr::string> kept(&arena);
+        {
+            alloc::Report report("cpp20 views stored in a pmr arena");
+            for (const auto& item : cpp20_style::expensiveWithDiscount(products)) {
+                kept.emplace_back(item);
+            }
+        }
+        auto stats = upstream.stats();
+        std::println("    of which arena blocks: {} allocations, {} bytes for {} strings",
+                     stats.count, stats.bytes, kept.size());
+        characters += kept.size();
+    }
+    std::println("  ({} characters produced)", characters);
+}
+
 void demo() {
     std::println("=== Performance Characteristics ===\n");
 
-    auto products = getProducts();
+    benchmarkPipelines();
+    std::println("");
+    reportPipelineAllocations();
 
-    // C++11: Creates intermediate containers
-    std::println("C++11 approach:");
-    std::println("  - Creates 2 temporary vectors");
-    std::println("  - Processes all elements even if only need first few");
-    std::println("  - Memory allocations for each container");
-
-    // C++17: Still creates intermediates
-    std::println("\nC++17 approach:");
-    std::println("  - Creates 1-2 temporary vectors");
-    std::println("  - Still processes everything");
-    std::println("  - Slightly better with algorithm composition");
-
-    // C++20/23: Lazy evaluation
-    std::println("\nC++20/23 approach:");
-    std::println("  - Zero intermediate containers (views)");
-    std::println("  - Lazy evaluation - only compute what's needed");
-    std::println("  - Can short-circuit with take()");
-    std::println("  - Composable without overhead");
+    auto products = getProducts();
 
     // Demonstrate lazy evaluation
     std::println("\nLazy evaluation example:");
@@ -364,7 +2019,15 @@ int main() {
     cpp17_style::demo();
     cpp20_style::demo();
     cpp23_style::demo();
+    columnar::demo();
+    vectorized::demo();
+    parallel::demo();
+    aggregation::demo();
+    ranking::demo();
+    ingestion::demo();
+    pmr_style::demo();
     performance::demo();
 
+    trace::report();
     return 0;
 }
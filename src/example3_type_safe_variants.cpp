@@ -13,6 +13,29 @@
 #include <variant>     // C++17
 #include <print>       // C++23
 #include <vector>
+#include <array>
+#include <algorithm>
+#include <span>        // C++20
+#include <cstdint>
+#include <limits>
+#include <stdexcept>
+#include <chrono>
+#include <bit>         // C++20
+#include <unordered_map>
+#include <cmath>
+#include <format>
+#include <random>
+#include <string_view>
+#include <utility>
+
+#include "benchmark.hpp"
+#include "trace.hpp"
+
+#if defined(__AVX2__)
+#include <immintrin.h>
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+#include <arm_neon.h>
+#endif
 
 // ============================================================================
 // C++11 Style: Tagged unions (manual type tracking)
@@ -162,6 +185,8 @@ struct Expr {
     Expr(Multiplication&& mul) : value(std::move(mul)) {}
 };
 
+double evaluate(const Expr& expr);  // Used by the visitor before its definition
+
 // Using std::visit for type-safe pattern matching
 struct EvaluateVisitor {
     double operator()(double n) const {
@@ -296,13 +321,68 @@ struct Subtraction {
     std::unique_ptr<Expr> right;
 };
 
+// Placeholder leaf: its value is supplied at evaluation time
+struct Variable {
+    std::size_t index;  // Position in the bindings passed to evaluate()
+};
+
 struct Expr {
-    std::variant<double, Addition, Multiplication, Subtraction> value;
+    std::variant<double, Variable, Addition, Multiplication, Subtraction> value;
 
     Expr(double n) : value(n) {}
+    Expr(Variable var) : value(var) {}
     Expr(Addition&& add) : value(std::move(add)) {}
     Expr(Multiplication&& mul) : value(std::move(mul)) {}
     Expr(Subtraction&& sub) : value(std::move(sub)) {}
+
+    Expr(Expr&&) = default;
+    Expr& operator=(Expr&&) = default;
+
+    // The implicit destructor recurses once per level through the
+    // unique_ptr chain, so a deep tree would overflow the stack. Free the
+    // children with a loop instead; it allocates nothing, so it cannot
+    // fail while the destructor runs, even during unwinding.
+    ~Expr() {
+        if (auto [left, right] = children(); left) {
+            release(std::move(*left));
+            release(std::move(*right));
+        }
+    }
+
+private:
+    using Children = std::pair<std::unique_ptr<Expr>*, std::unique_ptr<Expr>*>;
+
+    Children children() noexcept {
+        if (value.valueless_by_exception()) return {};
+        return std::visit([](auto& node) -> Children {
+            if constexpr (requires { node.left; node.right; }) {
+                return {&node.left, &node.right};
+            } else {
+                return {};
+            }
+        }, value);
+    }
+
+    // Rotate left children up until the root has none, then free the root
+    // and continue with its right child. Every node is freed with both
+    // children detached, so each ~Expr returns straight away.
+    static void release(std::unique_ptr<Expr> root) noexcept {
+        while (root) {
+            auto [left, right] = root->children();
+            if (!left) {
+                root.reset();  // Leaf
+            } else if (!*left) {
+                root = std::move(*right);
+            } else {
+                auto child = std::move(*left);
+                auto [child_left, child_right] = child->children();
+                if (!child_left) continue;  // Leaf child: `child` frees it
+                *left = std::move(*child_right);
+                *child_right = std::move(root);
+                root = std::move(child);
+            }
+        }
+    }
 };
 
 // Overload pattern helper (C++20 feature often used with variants)
@@ -315,17 +395,23 @@ struct overload : Ts... {
 template<class... Ts>
 overload(Ts...) -> overload<Ts...>;
 
-double evaluate(const Expr& expr) {
+double evaluate(const Expr& expr, std::span<const double> bindings = {}) {
     return std::visit(overload{
         [](double n) { return n; },
-        [](const Addition& add) {
-            return evaluate(*add.left) + evaluate(*add.right);
+        [&](const Variable& var) {
+            if (var.index >= bindings.size()) {
+                throw std::out_of_range("Unbound variable x" + std::to_string(var.index));
+            }
+            return bindings[var.index];
         },
-        [](const Multiplication& mul) {
-            return evaluate(*mul.left) * evaluate(*mul.right);
+        [&](const Addition& add) {
+            return evaluate(*add.left, bindings) + evaluate(*add.right, bindings);
         },
-        [](const Subtraction& sub) {
-            return evaluate(*sub.left) - evaluate(*sub.right);
+        [&](const Multiplication& mul) {
+            return evaluate(*mul.left, bindings) * evaluate(*mul.right, bindings);
+        },
+        [&](const Subtraction& sub) {
+            return evaluate(*sub.left, bindings) - evaluate(*sub.right, bindings);
         }
     }, expr.value);
 }
@@ -333,6 +419,7 @@ double evaluate(const Expr& expr) {
 void print(const Expr& expr) {
     std::visit(overload{
         [](double n) { std::print("{}", n); },
+        [](const Variable& var) { std::print("x{}", var.index); },
         [](const Addition& add) {
             std::print("(");
             print(*add.left);
@@ -522,6 +609,1395 @@ void demo() {
 
 } // namespace cpp26_style
 
+// ============================================================================
+// Arena Style: Flat node pool with 32-bit child indices
+// ============================================================================
+
+namespace arena_style {
+
+// Every node lives in one contiguous std::vector instead of its own heap
+// allocation, and children are referenced by a 32-bit index into that vector.
+
+enum class NodeKind : std::uint8_t {
+    Number,
+    Variable,
+    Addition,
+    Multiplication,
+    Subtraction
+};
+
+// Lightweight handle to a node inside an ExprPool
+struct ExprRef {
+    std::uint32_t index;
+};
+
+struct Node {
+    NodeKind kind;
+    std::uint32_t first;  // Lowest index in this node's subtree (set by ExprPool)
+
+    // A node is either a leaf or a binary operation, never both,
+    // so the payloads share storage and a node stays 16 bytes
+    union {
+        double number;
+        std::uint32_t variable;
+        struct {
+            std::uint32_t left;
+            std::uint32_t right;
+        } children;
+    };
+};
+
+static_assert(sizeof(Node) == 16, "Node should fit four to a cache line");
+
+class ExprPool {
+    std::vector<Node> nodes_;
+
+    ExprRef push(Node node) {
+        if (nodes_.size() >= std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("ExprPool is limited to 2^32 - 1 nodes");
+        }
+        node.first = node.kind == NodeKind::Number || node.kind == NodeKind::Variable
+            ? static_cast<std::uint32_t>(nodes_.size())
+            : std::min(nodes_[node.children.left].first, nodes_[node.children.right].first);
+        nodes_.push_back(node);
+        return ExprRef{static_cast<std::uint32_t>(nodes_.size() - 1)};
+    }
+
+    ExprRef binary(NodeKind kind, ExprRef left, ExprRef right) {
+        // Children must already exist, so a child index is always smaller
+        // than its parent's. evaluate() relies on this ordering.
+        if (left.index >= nodes_.size() || right.index >= nodes_.size()) {
+            throw std::out_of_range("Child node does not belong to this pool");
+        }
+        Node node{kind, 0, {}};
+        node.children = {left.index, right.index};
+        return push(node);
+    }
+
+public:
+    ExprPool() = default;
+    explicit ExprPool(std::size_t expected_nodes) { reserve(expected_nodes); }
+
+    void reserve(std::size_t n) { nodes_.reserve(n); }
+    std::size_t size() const { return nodes_.size(); }
+    std::size_t bytes() const { return nodes_.capacity() * sizeof(Node); }
+
+    // Construction helpers mirroring the Addition/Multiplication/Subtraction structs
+    ExprRef number(double n) {
+        Node node{NodeKind::Number, 0, {}};
+        node.number = n;
+        return push(node);
+    }
+
+    ExprRef variable(std::uint32_t index) {
+        Node node{NodeKind::Variable, 0, {}};
+        node.variable = index;
+        return push(node);
+    }
+
+    ExprRef add(ExprRef left, ExprRef right) {
+        return binary(NodeKind::Addition, left, right);
+    }
+
+    ExprRef multiply(ExprRef left, ExprRef right) {
+        return binary(NodeKind::Multiplication, left, right);
+    }
+
+    ExprRef subtract(ExprRef left, ExprRef right) {
+        return binary(NodeKind::Subtraction, left, right);
+    }
+
+    const Node& operator[](ExprRef ref) const { return nodes_[ref.index]; }
+
+    // Number of scratch values evaluate() needs for the subtree at `root`
+    std::size_t span(ExprRef root) const { return root.index + 1 - nodes_[root.index].first; }
+
+    std::span<const Node> nodes() const { return nodes_; }
+};
+
+// Because children always precede their parents, the subtree rooted at
+// `root` lies within pool indices [first, root] and can be evaluated with
+// one forward sweep over that span: no recursion and strictly sequential
+// memory access. Nodes of other expressions interleaved in the span are
+// evaluated too; those reaching below `first` are skipped. `scratch` holds
+// one value per node of the span (pool.span(root)) and can be reused
+// across calls.
+double evaluate(const ExprPool& pool, ExprRef root, std::span<const double> bindings,
+                std::span<double> scratch) {
+    TRACE_SCOPE("arena evaluate");
+    std::uint32_t first = pool[root].first;
+    auto nodes = pool.nodes().subspan(first, root.index + 1 - first);
+    if (scratch.size() < nodes.size()) {
+        throw std::invalid_argument("Scratch space is smaller than the subtree span");
+    }
+    auto value = [&](std::uint32_t index) { return scratch[index - first]; };
+
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        const Node& node = nodes[i];
+        if (node.first < first) continue;  // Not part of root's subtree
+        switch (node.kind) {
+            case NodeKind::Number:
+                scratch[i] = node.number;
+                break;
+            case NodeKind::Variable:
+                if (node.variable >= bindings.size()) {
+                    throw std::out_of_range("Unbound variable x" + std::to_string(node.variable));
+                }
+                scratch[i] = bindings[node.variable];
+                break;
+            case NodeKind::Addition:
+                scratch[i] = value(node.children.left) + value(node.children.right);
+                break;
+            case NodeKind::Multiplication:
+                scratch[i] = value(node.children.left) * value(node.children.right);
+                break;
+            case NodeKind::Subtraction:
+                scratch[i] = value(node.children.left) - value(node.children.right);
+                break;
+        }
+    }
+    return scratch[nodes.size() - 1];
+}
+
+// Convenience form that allocates its own scratch space
+double evaluate(const ExprPool& pool, ExprRef root, std::span<const double> bindings = {}) {
+    std::vector<double> scratch(pool.span(root));
+    return evaluate(pool, root, bindings, scratch);
+}
+
+void print(const ExprPool& pool, ExprRef ref) {
+    const Node& node = pool[ref];
+    if (node.kind == NodeKind::Number) {
+        std::print("{}", node.number);
+        return;
+    }
+    if (node.kind == NodeKind::Variable) {
+        std::print("x{}", node.variable);
+        return;
+    }
+
+    const char* op = node.kind == NodeKind::Addition       ? " + "
+                   : node.kind == NodeKind::Multiplication ? " * "
+                   :                                         " - ";
+    std::print("(");
+    print(pool, ExprRef{node.children.left});
+    std::print("{}", op);
+    print(pool, ExprRef{node.children.right});
+    std::print(")");
+}
+
+// Nodes store variable indices in 32 bits
+std::uint32_t variableIndex(const cpp20_style::Variable& var) {
+    if (var.index > std::numeric_limits<std::uint32_t>::max()) {
+        throw std::length_error("ExprPool variable indices are limited to 2^32 - 1");
+    }
+    return static_cast<std::uint32_t>(var.index);
+}
+
+// Copy an existing unique_ptr tree into a pool
+ExprRef flatten(ExprPool& pool, const cpp20_style::Expr& expr) {
+    return std::visit(cpp20_style::overload{
+        [&](double n) { return pool.number(n); },
+        [&](const cpp20_style::Variable& var) {
+            return pool.variable(variableIndex(var));
+        },
+        [&](const cpp20_style::Addition& add) {
+            auto left = flatten(pool, *add.left);
+            return pool.add(left, flatten(pool, *add.right));
+        },
+        [&](const cpp20_style::Multiplication& mul) {
+            auto left = flatten(pool, *mul.left);
+            return pool.multiply(left, flatten(pool, *mul.right));
+        },
+        [&](const cpp20_style::Subtraction& sub) {
+            auto left = flatten(pool, *sub.left);
+            return pool.subtract(left, flatten(pool, *sub.right));
+        }
+    }, expr.value);
+}
+
+void demo() {
+    std::println("=== Arena Style: Flat Node Pool ===\n");
+
+    // Build expression: (10 - 3) * (2 + 4)
+    ExprPool pool;
+    auto sub = pool.subtract(pool.number(10.0), pool.number(3.0));
+    auto add = pool.add(pool.number(2.0), pool.number(4.0));
+    auto expr = pool.multiply(sub, add);
+
+    std::print("Expression: ");
+    print(pool, expr);
+    std::println("");
+    std::println("Result: {}", evaluate(pool, expr));  // 42
+
+    // Large expression: sum of one million leaves, built into a single buffer
+    constexpr std::size_t leaves = 1'000'000;
+    ExprPool big(2 * leaves);
+    auto sum = big.number(0.0);
+    for (std::size_t i = 1; i < leaves; ++i) {
+        sum = big.add(sum, big.number(1.0));
+    }
+    std::println("\n{} nodes in one {} KiB allocation, sum = {}",
+                big.size(), big.bytes() / 1024, evaluate(big, sum));
+
+    // A small expression added after it sweeps only its own nodes, into
+    // scratch space the caller can reuse
+    auto tail = big.multiply(big.number(6.0), big.number(7.0));
+    std::vector<double> scratch(big.span(tail));
+    std::println("Subtree at the end of the pool: {} nodes swept, result {}",
+                 scratch.size(), evaluate(big, tail, {}, scratch));
+
+    // Existing trees can be converted
+    auto ten = std::make_unique<cpp20_style::Expr>(10.0);
+    auto two = std::make_unique<cpp20_style::Expr>(2.0);
+    cpp20_style::Expr tree(cpp20_style::Subtraction{std::move(ten), std::move(two)});
+
+    ExprPool converted;
+    auto root = flatten(converted, tree);
+    std::print("Flattened tree: ");
+    print(converted, root);
+    std::println(" = {}", evaluate(converted, root));
+
+    // Advantages over unique_ptr nodes:
+    // - One allocation per pool instead of one per node
+    // - 16-byte nodes with 32-bit links (half the size of two pointers)
+    // - Children before parents: evaluation is a linear scan
+    // - Whole tree freed at once when the pool goes away
+
+    std::println("");
+}
+
+} // namespace arena_style
+
+// ============================================================================
+// Bytecode Style: Compile once, evaluate many times
+// ============================================================================
+
+namespace bytecode {
+
+// The tree is lowered to postfix order, so evaluation becomes a loop over a
+// flat instruction array driving a small value stack: no std::visit and no
+// recursion per node.
+
+enum class OpCode : std::uint8_t {
+    PushConstant,  // operand: index into Program::constants
+    PushVariable,  // operand: index into the bindings
+    Add,
+    Multiply,
+    Subtract
+};
+
+struct Instruction {
+    OpCode op;
+    std::uint32_t operand;
+};
+
+struct Program {
+    std::vector<Instruction> code;
+    std::vector<double> constants;
+    std::size_t max_stack = 0;       // Deepest value stack run() will need
+    std::size_t variable_count = 0;  // Minimum number of bindings required
+};
+
+namespace detail {
+
+class Compiler {
+    Program program_;
+    std::size_t depth_ = 0;
+
+    void emit(OpCode op, std::size_t operand = 0) {
+        if (operand > std::numeric_limits<std::uint32_t>::max()) {
+            throw std::length_error("Bytecode operands are limited to 2^32 - 1");
+        }
+        program_.code.push_back({op, static_cast<std::uint32_t>(operand)});
+
+        if (op == OpCode::PushConstant || op == OpCode::PushVariable) {
+            program_.max_stack = std::max(program_.max_stack, ++depth_);
+        } else {
+            --depth_;  // Binary ops pop two and push one
+        }
+    }
+
+    template<typename Binary>
+    void binary(const Binary& node, OpCode op) {
+        compile(*node.left);
+        compile(*node.right);
+        emit(op);
+    }
+
+public:
+    void compile(const cpp20_style::Expr& expr) {
+        std::visit(cpp20_style::overload{
+            [&](double n) {
+                program_.constants.push_back(n);
+                emit(OpCode::PushConstant, program_.constants.size() - 1);
+            },
+            [&](const cpp20_style::Variable& var) {
+                program_.variable_count = std::max(program_.variable_count, var.index + 1);
+                emit(OpCode::PushVariable, var.index);
+            },
+            [&](const cpp20_style::Addition& add) { binary(add, OpCode::Add); },
+            [&](const cpp20_style::Multiplication& mul) { binary(mul, OpCode::Multiply); },
+            [&](const cpp20_style::Subtraction& sub) { binary(sub, OpCode::Subtract); }
+        }, expr.value);
+    }
+
+    Program finish() { return std::move(program_); }
+};
+
+} // namespace detail
+
+Program compile(const cpp20_style::Expr& expr) {
+    detail::Compiler compiler;
+    compiler.compile(expr);
+    return compiler.finish();
+}
+
+// Owns the value stack so repeated runs don't allocate
+class VirtualMachine {
+    const Program& program_;
+    std::vector<double> stack_;
+
+public:
+    explicit VirtualMachine(const Program& program)
+        : program_(program), stack_(program.max_stack) {}
+
+    // The program is referenced, not copied: it must outlive the machine
+    explicit VirtualMachine(Program&&) = delete;
+
+    double run(std::span<const double> bindings) {
+        TRACE_SCOPE("bytecode run");
+        if (bindings.size() < program_.variable_count) {
+            throw std::invalid_argument("Program needs " +
+                std::to_string(program_.variable_count) + " bindings");
+        }
+
+        const double* constants = program_.constants.data();
+        double* sp = stack_.data();  // Points one past the top of the stack
+
+        for (const Instruction& ins : program_.code) {
+            switch (ins.op) {
+                case OpCode::PushConstant:
+                    *sp++ = constants[ins.operand];
+                    break;
+                case OpCode::PushVariable:
+                    *sp++ = bindings[ins.operand];
+                    break;
+                case OpCode::Add:
+                    --sp;
+                    sp[-1] += sp[0];
+                    break;
+                case OpCode::Multiply:
+                    --sp;
+                    sp[-1] *= sp[0];
+                    break;
+                case OpCode::Subtract:
+                    --sp;
+                    sp[-1] -= sp[0];
+                    break;
+            }
+        }
+        return stack_[0];
+    }
+};
+
+void disassemble(const Program& program) {
+    for (std::size_t pc = 0; pc < program.code.size(); ++pc) {
+        const Instruction& ins = program.code[pc];
+        switch (ins.op) {
+            case OpCode::PushConstant:
+                std::println("  {:3}: push {}", pc, program.constants[ins.operand]);
+                break;
+            case OpCode::PushVariable:
+                std::println("  {:3}: load x{}", pc, ins.operand);
+                break;
+            case OpCode::Add:      std::println("  {:3}: add", pc); break;
+            case OpCode::Multiply: std::println("  {:3}: mul", pc); break;
+            case OpCode::Subtract: std::println("  {:3}: sub", pc); break;
+        }
+    }
+}
+
+void demo() {
+    std::println("=== Bytecode Style: Compiled Stack Machine ===\n");
+
+    using namespace cpp20_style;
+
+    // Build expression: (x0 * 2) + (x1 - 3)
+    auto mul = std::make_unique<Expr>(Multiplication{
+        std::make_unique<Expr>(Variable{0}), std::make_unique<Expr>(2.0)});
+    auto sub = std::make_unique<Expr>(Subtraction{
+        std::make_unique<Expr>(Variable{1}), std::make_unique<Expr>(3.0)});
+    Expr expr(Addition{std::move(mul), std::move(sub)});
+
+    std::print("Expression: ");
+    cpp20_style::print(expr);
+    std::println("");
+
+    // Compile once...
+    Program program = compile(expr);
+    std::println("Compiled to {} instructions (stack depth {}):",
+                program.code.size(), program.max_stack);
+    disassemble(program);
+
+    // ...then re-run against new bindings without touching the tree
+    VirtualMachine vm(program);
+    std::println("\nRe-running with different inputs:");
+    for (const auto& inputs : {std::array{1.0, 5.0}, std::array{10.0, 0.0},
+                               std::array{-2.5, 3.0}}) {
+        std::println("  x0={}, x1={}: vm={}, tree={}", inputs[0], inputs[1],
+                    vm.run(inputs), cpp20_style::evaluate(expr, inputs));
+    }
+
+    // Advantages over recursive std::visit:
+    // - One compact pass over contiguous instructions
+    // - No variant dispatch or call overhead per node
+    // - Stack size known at compile time (no allocation per run)
+    // - Program reusable across thousands of input bindings
+
+    std::println("");
+}
+
+} // namespace bytecode
+
+// ============================================================================
+// Batch Style: Column-at-a-time evaluation with SIMD kernels
+// ============================================================================
+
+namespace batch {
+
+// Instead of calling evaluate() once per row, the tree is walked once per
+// block of rows and every operator runs as a vectorized loop over the whole
+// block. Blocks are small enough that intermediate results stay in cache.
+
+constexpr std::size_t block_size = 1024;
+
+enum class BinaryOp { Add, Multiply, Subtract };
+
+template<BinaryOp Op>
+double apply(double a, double b) {
+    if constexpr (Op == BinaryOp::Add) return a + b;
+    else if constexpr (Op == BinaryOp::Multiply) return a * b;
+    else return a - b;
+}
+
+// out[i] = a[i] op b[i]; out may alias a or b
+template<BinaryOp Op>
+void binary_kernel(const double* a, const double* b, double* out, std::size_t n) {
+    std::size_t i = 0;
+#if defined(__AVX2__)
+    for (; i + 4 <= n; i += 4) {
+        __m256d x = _mm256_loadu_pd(a + i);
+        __m256d y = _mm256_loadu_pd(b + i);
+        __m256d r;
+        if constexpr (Op == BinaryOp::Add) r = _mm256_add_pd(x, y);
+        else if constexpr (Op == BinaryOp::Multiply) r = _mm256_mul_pd(x, y);
+        else r = _mm256_sub_pd(x, y);
+        _mm256_storeu_pd(out + i, r);
+    }
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    for (; i + 2 <= n; i += 2) {
+        float64x2_t x = vld1q_f64(a + i);
+        float64x2_t y = vld1q_f64(b + i);
+        float64x2_t r;
+        if constexpr (Op == BinaryOp::Add) r = vaddq_f64(x, y);
+        else if constexpr (Op == BinaryOp::Multiply) r = vmulq_f64(x, y);
+        else r = vsubq_f64(x, y);
+        vst1q_f64(out + i, r);
+    }
+#endif
+    // Scalar fallback and tail
+    for (; i < n; ++i) {
+        out[i] = apply<Op>(a[i], b[i]);
+    }
+}
+
+class BatchEvaluator {
+    std::span<const std::span<const double>> columns_;
+    std::vector<std::unique_ptr<double[]>> blocks_;  // Owns every scratch block
+    std::vector<double*> free_blocks_;
+
+    // Result of a subtree for the current block. `owned` is set when the
+    // data lives in a scratch block that must be recycled.
+    struct Column {
+        const double* data;
+        double* owned;
+    };
+
+    double* acquire() {
+        if (free_blocks_.empty()) {
+            blocks_.push_back(std::make_unique_for_overwrite<double[]>(block_size));
+            return blocks_.back().get();
+        }
+        double* block = free_blocks_.back();
+        free_blocks_.pop_back();
+        return block;
+    }
+
+    void release(double* block) {
+        if (block) free_blocks_.push_back(block);
+    }
+
+    template<BinaryOp Op, typename Binary>
+    Column binary(const Binary& node, std::size_t offset, std::size_t n) {
+        Column left = evaluate(*node.left, offset, n);
+        Column right = evaluate(*node.right, offset, n);
+
+        // Reuse a child's scratch block for the result when possible
+        double* out = left.owned ? left.owned : right.owned ? right.owned : acquire();
+        binary_kernel<Op>(left.data, right.data, out, n);
+
+        if (left.owned && left.owned != out) release(left.owned);
+        if (right.owned && right.owned != out) release(right.owned);
+        return {out, out};
+    }
+
+public:
+    explicit BatchEvaluator(std::span<const std::span<const double>> columns)
+        : columns_(columns) {}
+
+    Column evaluate(const cpp20_style::Expr& expr, std::size_t offset, std::size_t n) {
+        return std::visit(cpp20_style::overload{
+            [&](double value) {
+                double* out = acquire();
+                std::fill_n(out, n, value);
+                return Column{out, out};
+            },
+            [&](const cpp20_style::Variable& var) {
+                if (var.index >= columns_.size()) {
+                    throw std::out_of_range("Unbound variable x" + std::to_string(var.index));
+                }
+                // Input columns are read in place, never copied
+                return Column{columns_[var.index].data() + offset, nullptr};
+            },
+            [&](const cpp20_style::Addition& add) {
+                return binary<BinaryOp::Add>(add, offset, n);
+            },
+            [&](const cpp20_style::Multiplication& mul) {
+                return binary<BinaryOp::Multiply>(mul, offset, n);
+            },
+            [&](const cpp20_style::Subtraction& sub) {
+                return binary<BinaryOp::Subtract>(sub, offset, n);
+            }
+        }, expr.value);
+    }
+
+    void recycle(Column column) { release(column.owned); }
+};
+
+// Evaluate `expr` for every row: variable x<i> reads columns[i][row]
+void evaluate_batch(const cpp20_style::Expr& expr,
+                    std::span<const std::span<const double>> columns,
+                    std::span<double> out) {
+    TRACE_SCOPE("batch evaluate");
+    for (const auto& column : columns) {
+        if (column.size() != out.size()) {
+            throw std::invalid_argument("Input columns must match output size");
+        }
+    }
+
+    BatchEvaluator evaluator(columns);
+    for (std::size_t offset = 0; offset < out.size(); offset += block_size) {
+        std::size_t n = std::min(block_size, out.size() - offset);
+        auto result = evaluator.evaluate(expr, offset, n);
+        std::copy_n(result.data, n, out.data() + offset);
+        evaluator.recycle(result);
+    }
+}
+
+void demo() {
+    std::println("=== Batch Style: Vectorized Column Evaluation ===\n");
+
+    using namespace cpp20_style;
+
+    // Build expression: (x0 * 2) + (x1 - 3)
+    auto mul = std::make_unique<Expr>(Multiplication{
+        std::make_unique<Expr>(Variable{0}), std::make_unique<Expr>(2.0)});
+    auto sub = std::make_unique<Expr>(Subtraction{
+        std::make_unique<Expr>(Variable{1}), std::make_unique<Expr>(3.0)});
+    Expr expr(Addition{std::move(mul), std::move(sub)});
+
+    constexpr std::size_t rows = 1'000'000;
+    std::vector<double> x0(rows), x1(rows);
+    for (std::size_t i = 0; i < rows; ++i) {
+        x0[i] = static_cast<double>(i) * 0.5;
+        x1[i] = static_cast<double>(rows - i);
+    }
+
+    std::array<std::span<const double>, 2> columns{x0, x1};
+    std::vector<double> batched(rows), per_row(rows);
+
+    auto start = std::chrono::steady_clock::now();
+    evaluate_batch(expr, columns, batched);
+    auto batch_time = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (std::size_t i = 0; i < rows; ++i) {
+        per_row[i] = cpp20_style::evaluate(expr, std::array{x0[i], x1[i]});
+    }
+    auto row_time = std::chrono::steady_clock::now() - start;
+
+    using ms = std::chrono::duration<double, std::milli>;
+    std::println("Rows: {}", rows);
+    std::println("  Batched (one walk per {} rows): {:.2f} ms",
+                block_size, ms(batch_time).count());
+    std::println("  Per-row evaluate():             {:.2f} ms", ms(row_time).count());
+    std::println("  Results match: {}", batched == per_row);
+
+#if defined(__AVX2__)
+    std::println("  Kernels: AVX2 (4 doubles per instruction)");
+#elif defined(__ARM_NEON) && defined(__aarch64__)
+    std::println("  Kernels: NEON (2 doubles per instruction)");
+#else
+    std::println("  Kernels: scalar fallback (compile with -mavx2 for SIMD)");
+#endif
+
+    std::println("");
+}
+
+} // namespace batch
+
+// ============================================================================
+// Optimizer: Constant folding and common-subexpression elimination
+// ============================================================================
+
+namespace optimizer {
+
+// Rewrites a cpp20_style tree into an arena_style pool. Constant subtrees
+// are folded, trivial identities removed, and structurally identical
+// subtrees are hash-consed so they are stored (and evaluated) only once.
+// The result is a DAG: a shared node may have several parents.
+
+// Real version of the isConstant() pattern sketched in cpp26_style
+bool isConstant(const cpp20_style::Expr& expr) {
+    return std::visit(cpp20_style::overload{
+        [](double) { return true; },
+        [](const cpp20_style::Variable&) { return false; },
+        [](const auto& binary) { return isConstant(*binary.left) && isConstant(*binary.right); }
+    }, expr.value);
+}
+
+std::size_t countNodes(const cpp20_style::Expr& expr) {
+    return std::visit(cpp20_style::overload{
+        [](double) -> std::size_t { return 1; },
+        [](const cpp20_style::Variable&) -> std::size_t { return 1; },
+        [](const auto& binary) -> std::size_t {
+            return 1 + countNodes(*binary.left) + countNodes(*binary.right);
+        }
+    }, expr.value);
+}
+
+struct Stats {
+    std::size_t folded = 0;      // Operations replaced by their constant result
+    std::size_t simplified = 0;  // Operations removed by an algebraic identity
+    std::size_t shared = 0;      // Nodes reused instead of being created again
+};
+
+class Optimizer {
+    using ExprPool = arena_style::ExprPool;
+    using ExprRef = arena_style::ExprRef;
+    using NodeKind = arena_style::NodeKind;
+
+    // Structural identity of a node: kind plus its payload bits
+    struct Key {
+        NodeKind kind;
+        std::uint64_t payload;
+
+        bool operator==(const Key&) const = default;
+    };
+
+    struct KeyHash {
+        std::size_t operator()(const Key& key) const {
+            std::uint64_t h = key.payload * 0x9E3779B97F4A7C15ull;
+            return static_cast<std::size_t>(h ^ (h >> 29) ^ static_cast<std::uint64_t>(key.kind));
+        }
+    };
+
+    ExprPool pool_;
+    std::unordered_map<Key, ExprRef, KeyHash> interned_;
+    Stats stats_;
+
+    template<typename Make>
+    ExprRef intern(Key key, Make make) {
+        if (auto it = interned_.find(key); it != interned_.end()) {
+            ++stats_.shared;
+            return it->second;
+        }
+        ExprRef ref = make();
+        interned_.emplace(key, ref);
+        return ref;
+    }
+
+    ExprRef constant(double value) {
+        // Keyed by bit pattern so 0.0 and -0.0 stay distinct
+        return intern({NodeKind::Number, std::bit_cast<std::uint64_t>(value)},
+                      [&] { return pool_.number(value); });
+    }
+
+    const arena_style::Node* asConstant(ExprRef ref) const {
+        const auto& node = pool_[ref];
+        return node.kind == NodeKind::Number ? &node : nullptr;
+    }
+
+    bool isValue(ExprRef ref, double value) const {
+        auto node = asConstant(ref);
+        return node && node->number == value;
+    }
+
+    ExprRef binary(NodeKind kind, ExprRef left, ExprRef right) {
+        auto lc = asConstant(left);
+        auto rc = asConstant(right);
+
+        if (lc && rc) {
+            ++stats_.folded;
+            switch (kind) {
+                case NodeKind::Addition:       return constant(lc->number + rc->number);
+                case NodeKind::Multiplication: return constant(lc->number * rc->number);
+                default:                       return constant(lc->number - rc->number);
+            }
+        }
+
+        // Identities. Note x * 0 -> 0 ignores IEEE NaN/infinity propagation,
+        // which is the usual trade-off for generated arithmetic.
+        switch (kind) {
+            case NodeKind::Addition:
+                if (isValue(left, 0.0)) { ++stats_.simplified; return right; }
+                if (isValue(right, 0.0)) { ++stats_.simplified; return left; }
+                break;
+            case NodeKind::Multiplication:
+                if (isValue(left, 0.0) || isValue(right, 0.0)) {
+                    ++stats_.simplified;
+                    return constant(0.0);
+                }
+                if (isValue(left, 1.0)) { ++stats_.simplified; return right; }
+                if (isValue(right, 1.0)) { ++stats_.simplified; return left; }
+                break;
+            default:
+                if (isValue(right, 0.0)) { ++stats_.simplified; return left; }
+                break;
+        }
+
+        // Canonical operand order lets a + b and b + a share one node
+        if (kind != NodeKind::Subtraction && right.index < left.index) {
+            std::swap(left, right);
+        }
+
+        Key key{kind, (static_cast<std::uint64_t>(left.index) << 32) | right.index};
+        return intern(key, [&] {
+            switch (kind) {
+                case NodeKind::Addition:       return pool_.add(left, right);
+                case NodeKind::Multiplication: return pool_.multiply(left, right);
+                default:                       return pool_.subtract(left, right);
+            }
+        });
+    }
+
+public:
+    ExprRef optimize(const cpp20_style::Expr& expr) {
+        return std::visit(cpp20_style::overload{
+            [&](double n) { return constant(n); },
+            [&](const cpp20_style::Variable& var) {
+                auto index = arena_style::variableIndex(var);
+                return intern({NodeKind::Variable, index},
+                              [&] { return pool_.variable(index); });
+            },
+            [&](const cpp20_style::Addition& add) {
+                auto left = optimize(*add.left);
+                return binary(NodeKind::Addition, left, optimize(*add.right));
+            },
+            [&](const cpp20_style::Multiplication& mul) {
+                auto left = optimize(*mul.left);
+                return binary(NodeKind::Multiplication, left, optimize(*mul.right));
+            },
+            [&](const cpp20_style::Subtraction& sub) {
+                auto left = optimize(*sub.left);
+                return binary(NodeKind::Subtraction, left, optimize(*sub.right));
+            }
+        }, expr.value);
+    }
+
+    const ExprPool& pool() const { return pool_; }
+    const Stats& stats() const { return stats_; }
+};
+
+// Folding leaves dead leaves behind in the pool (the 2 and 3 of a folded
+// 2 * 3). Copy only the nodes reachable from `root` so the linear sweep in
+// arena_style::evaluate() touches live work only. Children precede parents,
+// so one backward pass marks and one forward pass copies.
+arena_style::ExprRef compact(const arena_style::ExprPool& pool, arena_style::ExprRef root,
+                             arena_style::ExprPool& out) {
+    using arena_style::NodeKind;
+    auto nodes = pool.nodes().first(root.index + 1);
+
+    std::vector<bool> live(nodes.size());
+    live[root.index] = true;
+    for (std::size_t i = nodes.size(); i-- > 0;) {
+        if (live[i] && nodes[i].kind != NodeKind::Number && nodes[i].kind != NodeKind::Variable) {
+            live[nodes[i].children.left] = true;
+            live[nodes[i].children.right] = true;
+        }
+    }
+
+    std::vector<arena_style::ExprRef> remap(nodes.size());
+    for (std::size_t i = 0; i < nodes.size(); ++i) {
+        if (!live[i]) continue;
+        const auto& node = nodes[i];
+        switch (node.kind) {
+            case NodeKind::Number:
+                remap[i] = out.number(node.number);
+                break;
+            case NodeKind::Variable:
+                remap[i] = out.variable(node.variable);
+                break;
+            case NodeKind::Addition:
+                remap[i] = out.add(remap[node.children.left], remap[node.children.right]);
+                break;
+            case NodeKind::Multiplication:
+                remap[i] = out.multiply(remap[node.children.left], remap[node.children.right]);
+                break;
+            case NodeKind::Subtraction:
+                remap[i] = out.subtract(remap[node.children.left], remap[node.children.right]);
+                break;
+        }
+    }
+    return remap[root.index];
+}
+
+void demo() {
+    std::println("=== Optimizer: Constant Folding + CSE ===\n");
+
+    using namespace cpp20_style;
+    auto num = [](double n) { return std::make_unique<Expr>(n); };
+    auto var = [](std::size_t i) { return std::make_unique<Expr>(Variable{i}); };
+
+    // Generated-looking code: the same subexpression repeated, plus noise
+    // term(x0) = (x0 * 1) + (2 * 3)
+    auto term = [&] {
+        return std::make_unique<Expr>(Addition{
+            std::make_unique<Expr>(Multiplication{var(0), num(1.0)}),
+            std::make_unique<Expr>(Multiplication{num(2.0), num(3.0)})});
+    };
+    // (term * term) + ((x1 * 0) + (term - 0))
+    auto noise = std::make_unique<Expr>(Addition{
+        std::make_unique<Expr>(Multiplication{var(1), num(0.0)}),
+        std::make_unique<Expr>(Subtraction{term(), num(0.0)})});
+    Expr expr(Addition{
+        std::make_unique<Expr>(Multiplication{term(), term()}),
+        std::move(noise)});
+
+    std::print("Original:  ");
+    cpp20_style::print(expr);
+    std::println("");
+
+    Optimizer opt;
+    auto root = opt.optimize(expr);
+
+    arena_style::ExprPool dag;
+    auto dag_root = compact(opt.pool(), root, dag);
+
+    std::print("Optimized: ");
+    arena_style::print(dag, dag_root);
+    std::println("");
+
+    const auto& stats = opt.stats();
+    std::println("\nTree nodes: {}, DAG nodes: {}", countNodes(expr), dag.size());
+    std::println("Folded: {}, simplified: {}, shared: {}",
+                stats.folded, stats.simplified, stats.shared);
+
+    std::array bindings{4.0, 7.0};
+    std::println("Tree result: {}, DAG result: {}",
+                cpp20_style::evaluate(expr, bindings),
+                arena_style::evaluate(dag, dag_root, bindings));
+    std::println("isConstant(2 * 3): {}",
+                isConstant(Expr(Multiplication{num(2.0), num(3.0)})));
+
+    std::println("");
+}
+
+} // namespace optimizer
+
+// ============================================================================
+// Iterative Style: Explicit-stack traversal for arbitrarily deep trees
+// ============================================================================
+
+namespace iterative {
+
+// cpp20_style::evaluate() and print() recurse once per level, so a
+// left-deep chain of a million additions overflows the call stack. These
+// versions keep their work list on the heap; stack usage is constant no
+// matter how deep the tree is. (Destruction is handled by ~Expr itself.)
+
+double evaluate(const cpp20_style::Expr& expr, std::span<const double> bindings = {}) {
+    using namespace cpp20_style;
+    TRACE_SCOPE("iterative evaluate");
+
+    // A node is visited twice: once to schedule its children, and once
+    // (`ready`) to combine their results from the value stack
+    struct Frame {
+        const Expr* node;
+        bool ready;
+    };
+
+    std::vector<Frame> work{{&expr, false}};
+    std::vector<double> values;
+
+    while (!work.empty()) {
+        Frame frame = work.back();
+        work.pop_back();
+
+        if (frame.ready) {
+            double right = values.back();
+            values.pop_back();
+            double& left = values.back();
+
+            std::visit(overload{
+                [&](const Addition&) { left += right; },
+                [&](const Multiplication&) { left *= right; },
+                [&](const Subtraction&) { left -= right; },
+                [](const auto&) {}  // Leaves are never scheduled as ready
+            }, frame.node->value);
+            continue;
+        }
+
+        std::visit(overload{
+            [&](double n) { values.push_back(n); },
+            [&](const Variable& var) {
+                if (var.index >= bindings.size()) {
+                    throw std::out_of_range("Unbound variable x" + std::to_string(var.index));
+                }
+                values.push_back(bindings[var.index]);
+            },
+            [&](const auto& binary) {
+                // Pushed in reverse: left is evaluated first
+                work.push_back({frame.node, true});
+                work.push_back({binary.right.get(), false});
+                work.push_back({binary.left.get(), false});
+            }
+        }, frame.node->value);
+    }
+
+    return values.back();
+}
+
+void print(const cpp20_style::Expr& expr) {
+    using namespace cpp20_style;
+
+    // Work items are either a node still to print or literal text
+    struct Item {
+        const Expr* node;
+        const char* text;
+    };
+
+    std::vector<Item> work{{&expr, nullptr}};
+
+    while (!work.empty()) {
+        Item item = work.back();
+        work.pop_back();
+
+        if (!item.node) {
+            std::print("{}", item.text);
+            continue;
+        }
+
+        auto schedule = [&](const auto& binary, const char* op) {
+            work.push_back({nullptr, ")"});
+            work.push_back({binary.right.get(), nullptr});
+            work.push_back({nullptr, op});
+            work.push_back({binary.left.get(), nullptr});
+            work.push_back({nullptr, "("});
+        };
+
+        std::visit(overload{
+            [](double n) { std::print("{}", n); },
+            [](const Variable& var) { std::print("x{}", var.index); },
+            [&](const Addition& add) { schedule(add, " + "); },
+            [&](const Multiplication& mul) { schedule(mul, " * "); },
+            [&](const Subtraction& sub) { schedule(sub, " - "); }
+        }, item.node->value);
+    }
+}
+
+void demo() {
+    std::println("=== Iterative Style: Deep Trees ===\n");
+
+    using namespace cpp20_style;
+
+    // (10 - 3) * (2 + x0), printed and evaluated without recursion
+    auto sub = std::make_unique<Expr>(Subtraction{
+        std::make_unique<Expr>(10.0), std::make_unique<Expr>(3.0)});
+    auto add = std::make_unique<Expr>(Addition{
+        std::make_unique<Expr>(2.0), std::make_unique<Expr>(Variable{0})});
+    Expr expr(Multiplication{std::move(sub), std::move(add)});
+
+    std::print("Expression: ");
+    iterative::print(expr);
+    std::println("");
+    std::println("Result (x0 = 4): {}", iterative::evaluate(expr, std::array{4.0}));
+
+    // Left-deep chain far beyond what recursion can handle
+    constexpr int depth = 1'000'000;
+    {
+        auto chain = std::make_unique<Expr>(0.0);
+        for (int i = 0; i < depth; ++i) {
+            chain = std::make_unique<Expr>(
+                Addition{std::move(chain), std::make_unique<Expr>(1.0)});
+        }
+
+        std::println("\nLeft-deep chain of {} additions: {}", depth, iterative::evaluate(*chain));
+    }  // chain destroyed iteratively by ~Expr
+    std::println("Chain destroyed without stack overflow");
+
+    std::println("");
+}
+
+} // namespace iterative
+
+// ============================================================================
+// Performance: Dispatch cost of each representation
+// ============================================================================
+
+namespace performance {
+
+// Classic OOP baseline: one heap object per node, dispatched through a vtable
+namespace oop {
+
+struct Node {
+    virtual ~Node() = default;
+    virtual double evaluate() const = 0;
+};
+
+struct Number final : Node {
+    double value;
+    explicit Number(double v) : value(v) {}
+    double evaluate() const override { return value; }
+};
+
+struct Addition final : Node {
+    std::unique_ptr<Node> left, right;
+    Addition(std::unique_ptr<Node> l, std::unique_ptr<Node> r)
+        : left(std::move(l)), right(std::move(r)) {}
+    double evaluate() const override { return left->evaluate() + right->evaluate(); }
+};
+
+struct Multiplication final : Node {
+    std::unique_ptr<Node> left, right;
+    Multiplication(std::unique_ptr<Node> l, std::unique_ptr<Node> r)
+        : left(std::move(l)), right(std::move(r)) {}
+    double evaluate() const override { return left->evaluate() * right->evaluate(); }
+};
+
+} // namespace oop
+
+// Builds the same tree in any of the unique_ptr representations
+template<typename E, typename Add, typename Mul>
+struct TreeBuilder {
+    std::unique_ptr<E> number(double v) { return std::make_unique<E>(v); }
+    std::unique_ptr<E> add(std::unique_ptr<E> l, std::unique_ptr<E> r) {
+        return std::make_unique<E>(Add{std::move(l), std::move(r)});
+    }
+    std::unique_ptr<E> multiply(std::unique_ptr<E> l, std::unique_ptr<E> r) {
+        return std::make_unique<E>(Mul{std::move(l), std::move(r)});
+    }
+};
+
+struct OopBuilder {
+    std::unique_ptr<oop::Node> number(double v) { return std::make_unique<oop::Number>(v); }
+    std::unique_ptr<oop::Node> add(std::unique_ptr<oop::Node> l, std::unique_ptr<oop::Node> r) {
+        return std::make_unique<oop::Addition>(std::move(l), std::move(r));
+    }
+    std::unique_ptr<oop::Node> multiply(std::unique_ptr<oop::Node> l, std::unique_ptr<oop::Node> r) {
+        return std::make_unique<oop::Multiplication>(std::move(l), std::move(r));
+    }
+};
+
+// Balanced tree over `leaves` leaves, alternating + and * by level. Leaf
+// values stay close to 1 so large products neither overflow nor vanish.
+template<typename Builder>
+auto buildBalanced(Builder& builder, std::size_t leaves, std::size_t level = 0) {
+    if (leaves == 1) return builder.number(1.0 + static_cast<double>(level % 7) * 1e-3);
+
+    auto left = buildBalanced(builder, leaves / 2, level + 1);
+    auto right = buildBalanced(builder, leaves - leaves / 2, level + 1);
+    return level % 2 == 0 ? builder.add(std::move(left), std::move(right))
+                          : builder.multiply(std::move(left), std::move(right));
+}
+
+void demo() {
+    std::println("=== Performance: Evaluation Dispatch ===\n");
+
+    bench::Suite suite("example3.evaluate_balanced");
+    bool agree = true;
+
+    for (std::size_t leaves : {16uz, 1'024uz, 65'536uz}) {
+        TreeBuilder<cpp11_style::Expr, cpp11_style::Addition, cpp11_style::Multiplication> b11;
+        TreeBuilder<cpp17_style::Expr, cpp17_style::Addition, cpp17_style::Multiplication> b17;
+        TreeBuilder<cpp20_style::Expr, cpp20_style::Addition, cpp20_style::Multiplication> b20;
+        OopBuilder boop;
+
+        auto tagged = buildBalanced(b11, leaves);
+        auto variant17 = buildBalanced(b17, leaves);
+        auto variant20 = buildBalanced(b20, leaves);
+        auto virtual_tree = buildBalanced(boop, leaves);
+
+        arena_style::ExprPool pool(2 * leaves);
+        auto root = arena_style::flatten(pool, *variant20);
+        auto program = bytecode::compile(*variant20);
+        bytecode::VirtualMachine vm(program);
+
+        std::size_t nodes = 2 * leaves - 1;
+        suite.run("cpp11 tagged union switch", nodes, [&] { return cpp11_style::evaluate(*tagged); });
+        suite.run("cpp17 visit (visitor struct)", nodes, [&] { return cpp17_style::evaluate(*variant17); });
+        suite.run("cpp17 visit (generic lambda)", nodes, [&] { return cpp17_style::evaluate_lambda(*variant17); });
+        suite.run("cpp20 visit (overload)", nodes, [&] { return cpp20_style::evaluate(*variant20); });
+        suite.run("virtual dispatch", nodes, [&] { return virtual_tree->evaluate(); });
+        suite.run("iterative explicit stack", nodes, [&] { return iterative::evaluate(*variant20); });
+        suite.run("arena linear sweep", nodes, [&] { return arena_style::evaluate(pool, root); });
+        suite.run("arena linear sweep, reused scratch", nodes,
+                  [&, scratch = std::vector<double>(pool.span(root))] mutable {
+                      return arena_style::evaluate(pool, root, {}, scratch);
+                  });
+        suite.run("bytecode VM", nodes, [&] { return vm.run({}); });
+
+        double expected = cpp20_style::evaluate(*variant20);
+        agree = agree
+            && cpp11_style::evaluate(*tagged) == expected
+            && cpp17_style::evaluate(*variant17) == expected
+            && virtual_tree->evaluate() == expected
+            && iterative::evaluate(*variant20) == expected
+            && arena_style::evaluate(pool, root) == expected
+            && vm.run({}) == expected;
+    }
+
+    suite.report();
+    std::println("\nAll representations agree: {}", agree);
+    std::println("");
+}
+
+} // namespace performance
+
+// ============================================================================
+// Dispatch Strategies: Choosing how a variant picks its alternative
+// ============================================================================
+
+namespace dispatch {
+
+// std::visit compiles to a jump table on some standard libraries and to a
+// chain of compares on others, and inlining across it varies as well. The
+// evaluator below takes the dispatch mechanism as a template parameter, so
+// the same tree can be evaluated with each and the fastest kept per
+// platform. Every strategy recurses through itself.
+
+using cpp20_style::Expr;
+using cpp20_style::Variable;
+using cpp20_style::Addition;
+using cpp20_style::Multiplication;
+using cpp20_style::Subtraction;
+
+using Alternatives = decltype(Expr::value);
+inline constexpr std::size_t alternative_count = std::variant_size_v<Alternatives>;
+
+enum class Strategy {
+    Visit,         // std::visit with a generic lambda
+    Switch,        // switch on index(), std::get_if per case
+    JumpTable,     // Array of function pointers indexed by index()
+    ComputedGoto   // GCC/Clang label addresses; a jump table elsewhere
+};
+
+inline constexpr std::array all_strategies{
+    Strategy::Visit, Strategy::Switch, Strategy::JumpTable, Strategy::ComputedGoto};
+
+constexpr std::string_view name(Strategy strategy) {
+    switch (strategy) {
+        case Strategy::Visit: return "std::visit";
+        case Strategy::Switch: return "switch on index()";
+        case Strategy::JumpTable: return "jump table";
+        case Strategy::ComputedGoto: return "computed goto";
+    }
+    return "?";
+}
+
+template<Strategy S>
+double evaluate(const Expr& expr, std::span<const double> bindings = {});
+
+double evaluateComputedGoto(const Expr& expr, std::span<const double> bindings);
+
+namespace detail {
+
+// What each alternative does, shared by all strategies
+template<Strategy S>
+double node(double n, std::span<const double>) { return n; }
+
+template<Strategy S>
+double node(const Variable& var, std::span<const double> bindings) {
+    if (var.index >= bindings.size()) {
+        throw std::out_of_range("Unbound variable x" + std::to_string(var.index));
+    }
+    return bindings[var.index];
+}
+
+template<Strategy S>
+double node(const Addition& add, std::span<const double> bindings) {
+    return evaluate<S>(*add.left, bindings) + evaluate<S>(*add.right, bindings);
+}
+
+template<Strategy S>
+double node(const Multiplication& mul, std::span<const double> bindings) {
+    return evaluate<S>(*mul.left, bindings) * evaluate<S>(*mul.right, bindings);
+}
+
+template<Strategy S>
+double node(const Subtraction& sub, std::span<const double> bindings) {
+    return evaluate<S>(*sub.left, bindings) - evaluate<S>(*sub.right, bindings);
+}
+
+// The switch and label list below name every alternative by position
+static_assert(alternative_count == 5, "Update the dispatch strategies for the new alternative");
+
+template<Strategy S, std::size_t I>
+double alternative(const Expr& expr, std::span<const double> bindings) {
+    return node<S>(*std::get_if<I>(&expr.value), bindings);
+}
+
+using Handler = double (*)(const Expr&, std::span<const double>);
+
+template<Strategy S>
+inline constexpr auto handlers = []<std::size_t... I>(std::index_sequence<I...>) {
+    return std::array<Handler, alternative_count>{&alternative<S, I>...};
+}(std::make_index_sequence<alternative_count>{});
+
+} // namespace detail
+
+template<Strategy S>
+double evaluate(const Expr& expr, std::span<const double> bindings) {
+    if constexpr (S == Strategy::Visit) {
+        return std::visit([&](const auto& value) { return detail::node<S>(value, bindings); }, expr.value);
+    } else if constexpr (S == Strategy::Switch) {
+        switch (expr.value.index()) {
+            case 0: return detail::alternative<S, 0>(expr, bindings);
+            case 1: return detail::alternative<S, 1>(expr, bindings);
+            case 2: return detail::alternative<S, 2>(expr, bindings);
+            case 3: return detail::alternative<S, 3>(expr, bindings);
+            case 4: return detail::alternative<S, 4>(expr, bindings);
+            default: throw std::bad_variant_access();  // Valueless
+        }
+    } else if constexpr (S == Strategy::JumpTable) {
+        std::size_t index = expr.value.index();
+        if (index >= alternative_count) throw std::bad_variant_access();
+        return detail::handlers<S>[index](expr, bindings);
+    } else {
+        return evaluateComputedGoto(expr, bindings);
+    }
+}
+
+double evaluateComputedGoto(const Expr& expr, std::span<const double> bindings) {
+    constexpr auto S = Strategy::ComputedGoto;
+    std::size_t index = expr.value.index();
+    if (index >= alternative_count) throw std::bad_variant_access();
+#if defined(__GNUC__) || defined(__clang__)
+    static void* const labels[] = {&&number, &&variable, &&addition, &&multiplication, &&subtraction};
+    goto *labels[index];
+number:         return detail::alternative<S, 0>(expr, bindings);
+variable:       return detail::alternative<S, 1>(expr, bindings);
+addition:       return detail::alternative<S, 2>(expr, bindings);
+multiplication: return detail::alternative<S, 3>(expr, bindings);
+subtraction:    return detail::alternative<S, 4>(expr, bindings);
+#else
+    return detail::handlers<S>[index](expr, bindings);
+#endif
+}
+
+// Strategy chosen at runtime, e.g. from BENCH results or configuration
+double evaluate(const Expr& expr, Strategy strategy, std::span<const double> bindings = {}) {
+    TRACE_SCOPE(name(strategy).data());  // name() returns string literals
+    switch (strategy) {
+        case Strategy::Visit: return evaluate<Strategy::Visit>(expr, bindings);
+        case Strategy::Switch: return evaluate<Strategy::Switch>(expr, bindings);
+        case Strategy::JumpTable: return evaluate<Strategy::JumpTable>(expr, bindings);
+        case Strategy::ComputedGoto: return evaluate<Strategy::ComputedGoto>(expr, bindings);
+    }
+    throw std::invalid_argument("Unknown dispatch strategy");
+}
+
+// Tree shapes. Left-deep trees recurse once per leaf, so keep them to a few
+// thousand leaves; random trees mix every alternative, variables included.
+
+std::unique_ptr<Expr> buildLeftDeep(std::size_t leaves) {
+    auto tree = std::make_unique<Expr>(1.0);
+    for (std::size_t i = 1; i < leaves; ++i) {
+        if (i % 2) {
+            tree = std::make_unique<Expr>(Addition{std::move(tree), std::make_unique<Expr>(1.0)});
+        } else {
+            tree = std::make_unique<Expr>(Multiplication{std::move(tree), std::make_unique<Expr>(0.5)});
+        }
+    }
+    return tree;
+}
+
+std::unique_ptr<Expr> buildRandom(std::mt19937& random, std::size_t leaves) {
+    if (leaves == 1) {
+        if (random() % 4 == 0) return std::make_unique<Expr>(Variable{random() % 2});
+        return std::make_unique<Expr>(0.9 + static_cast<double>(random() % 200) * 1e-3);
+    }
+    std::size_t left_leaves = 1 + random() % (leaves - 1);
+    auto left = buildRandom(random, left_leaves);
+    auto right = buildRandom(random, leaves - left_leaves);
+    switch (random() % 3) {
+        case 0: return std::make_unique<Expr>(Addition{std::move(left), std::move(right)});
+        case 1: return std::make_unique<Expr>(Multiplication{std::move(left), std::move(right)});
+        default: return std::make_unique<Expr>(Subtraction{std::move(left), std::move(right)});
+    }
+}
+
+void demo() {
+    std::println("=== Dispatch Strategies: visit vs switch vs jump table ===\n");
+
+    struct Shape {
+        std::string name;
+        std::size_t leaves;
+        std::unique_ptr<Expr> tree;
+    };
+
+    std::mt19937 random(2024);
+    performance::TreeBuilder<Expr, Addition, Multiplication> builder;
+    std::vector<Shape> shapes;
+    for (std::size_t leaves : {1'024uz, 65'536uz}) {
+        shapes.push_back({"balanced", leaves, performance::buildBalanced(builder, leaves)});
+        shapes.push_back({"random", leaves, buildRandom(random, leaves)});
+    }
+    shapes.push_back({"left-deep", 1'024, buildLeftDeep(1'024)});
+    shapes.push_back({"left-deep", 4'096, buildLeftDeep(4'096)});
+
+    const std::array bindings{1.0, 0.5};
+    bench::Suite suite("example3.dispatch");
+    bool agree = true;
+
+    for (const auto& shape : shapes) {
+        double expected = cpp20_style::evaluate(*shape.tree, bindings);
+        std::size_t nodes = 2 * shape.leaves - 1;
+        for (Strategy strategy : all_strategies) {
+            double result = evaluate(*shape.tree, strategy, bindings);
+            agree = agree && (result == expected || (std::isnan(result) && std::isnan(expected)));
+            suite.run(std::format("{} {}: {}", shape.name, shape.leaves, name(strategy)), nodes,
+                      [&] { return evaluate(*shape.tree, strategy, bindings); });
+        }
+    }
+    suite.report();
+    std::println("\nAll strategies agree with cpp20_style::evaluate: {}", agree);
+
+    // Results come in groups of all_strategies.size(), one group per shape
+    std::println("Fastest per shape on this build:");
+    auto results = suite.results();
+    for (std::size_t i = 0; i < shapes.size(); ++i) {
+        auto group = results.subspan(i * all_strategies.size(), all_strategies.size());
+        auto best = std::ranges::min_element(group, {}, &bench::Result::ns_per_op);
+        std::println("  {:<16} {}", std::format("{} {}", shapes[i].name, shapes[i].leaves),
+                     name(all_strategies[static_cast<std::size_t>(best - group.begin())]));
+    }
+    std::println("");
+}
+
+} // namespace dispatch
+
 // ============================================================================
 // Comparison: Same operation in different styles
 // ============================================================================
@@ -557,7 +2033,15 @@ int main() {
     cpp17_style::demo();
     cpp20_style::demo();
     cpp26_style::demo();
+    arena_style::demo();
+    bytecode::demo();
+    batch::demo();
+    optimizer::demo();
+    iterative::demo();
+    performance::demo();
+    dispatch::demo();
     comparison_demo();
 
+    trace::report();
     return 0;
 }
@@ -16,6 +16,41 @@
 #include <print>      // C++23
 #include <expected>   // C++23
 #include <concepts>   // C++20
+#include <algorithm>
+#include <stdexcept>
+#include <filesystem>
+#include <format>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#include <cerrno>
+#include <cstring>
+#include <array>
+#include <atomic>
+#include <bit>        // C++20
+#include <cstdint>
+#include <chrono>
+#include <condition_variable>
+#include <coroutine>  // C++20
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <ranges>     // C++20
+#include <semaphore>  // C++20
+#include <sstream>
+#include <stop_token> // C++20
+#include <thread>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#include "benchmark.hpp"
+#include "trace.hpp"
 
 // ============================================================================
 // C++11 Style: Manual Memory Management
@@ -288,6 +323,7 @@ class FileProcessor {
     std::unique_ptr<char[]> buffer_;
     size_t size_;
     std::string filename_;
+    size_t bytes_read_ = 0;
 
 public:
     FileProcessor(const std::string& filename, size_t buffer_size)
@@ -295,15 +331,19 @@ public:
           size_(buffer_size),
           filename_(filename) {}
 
+    // Fails rather than silently truncating a file larger than the buffer
     bool process() {
-        std::ifstream file(filename_);
+        TRACE_SCOPE("cpp20 FileProcessor::process");
+        std::ifstream file(filename_, std::ios::binary);
         if (!file) return false;
 
         file.read(buffer_.get(), size_);
-        return true;
+        bytes_read_ = static_cast<size_t>(file.gcount());
+        return file.peek() == std::ifstream::traits_type::eof();
     }
 
     size_t getSize() const { return size_; }
+    size_t getBytesRead() const { return bytes_read_; }
 
     // C++20: std::span for safe buffer access
     std::span<char> getBufferSpan() {
@@ -378,6 +418,7 @@ class FileProcessor {
     std::unique_ptr<char[]> buffer_;
     size_t size_;
     std::string filename_;
+    size_t bytes_read_ = 0;
 
 public:
     // C++26 contracts (proposed syntax)
@@ -423,14 +464,18 @@ public:
         return std::span<char>(buffer_.get() + offset, length);
     }
 
+    // Fails rather than silently truncating a file larger than the buffer
     bool process() {
-        std::ifstream file(filename_);
+        TRACE_SCOPE("cpp23 FileProcessor::process");
+        std::ifstream file(filename_, std::ios::binary);
         if (!file) return false;
         file.read(buffer_.get(), size_);
-        return true;
+        bytes_read_ = static_cast<size_t>(file.gcount());
+        return file.peek() == std::ifstream::traits_type::eof();
     }
 
     size_t getSize() const { return size_; }
+    size_t getBytesRead() const { return bytes_read_; }
 };
 
 // C++23: std::out_ptr for C API interop
@@ -501,6 +546,1134 @@ void demo() {
 
 } // namespace cpp23_style
 
+// ============================================================================
+// Mapped Style: Zero-copy file access with mmap
+// ============================================================================
+
+namespace mapped_style {
+
+// The FileProcessors above copy the file into a heap buffer sized up
+// front. Mapping the file instead lets the kernel page it in on demand:
+// no buffer allocation, no kernel-to-user copy, and the span always
+// covers the whole file.
+
+// Hint for how the mapping will be read (madvise on POSIX)
+enum class AccessPattern {
+    Normal,
+    Sequential,  // Aggressive read-ahead, pages dropped behind the reader
+    Random,      // No read-ahead
+    WillNeed     // Start reading the whole file in now
+};
+
+// Read-only mapping of a whole file, unmapped on destruction
+class MappedFile {
+    const char* data_ = nullptr;
+    std::size_t size_ = 0;
+#if !(defined(__unix__) || defined(__APPLE__))
+    std::unique_ptr<char[]> fallback_;  // No mmap: the file is read into memory
+#endif
+
+    void unmap() noexcept {
+#if defined(__unix__) || defined(__APPLE__)
+        if (data_) ::munmap(const_cast<char*>(data_), size_);
+#else
+        fallback_.reset();
+#endif
+        data_ = nullptr;
+        size_ = 0;
+    }
+
+public:
+    MappedFile() = default;
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0))
+#if !(defined(__unix__) || defined(__APPLE__))
+        , fallback_(std::move(other.fallback_))
+#endif
+    {}
+
+    MappedFile& operator=(MappedFile&& other) noexcept {
+        if (this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+#if !(defined(__unix__) || defined(__APPLE__))
+            fallback_ = std::move(other.fallback_);
+#endif
+        }
+        return *this;
+    }
+
+    ~MappedFile() { unmap(); }
+
+    static std::expected<MappedFile, std::string>
+    open(const std::string& path, AccessPattern pattern = AccessPattern::Sequential) {
+        MappedFile file;
+#if defined(__unix__) || defined(__APPLE__)
+        auto failure = [&](std::string_view what) {
+            return std::unexpected(std::format("{} {}: {}", what, path,
+                                               std::system_category().message(errno)));
+        };
+
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) return failure("Cannot open");
+
+        struct stat info{};
+        if (::fstat(fd, &info) != 0) {
+            auto error = failure("Cannot stat");
+            ::close(fd);
+            return error;
+        }
+
+        file.size_ = static_cast<std::size_t>(info.st_size);
+        if (file.size_ > 0) {  // mmap rejects zero-length mappings
+            void* p = ::mmap(nullptr, file.size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (p == MAP_FAILED) {
+                auto error = failure("Cannot map");
+                ::close(fd);
+                return error;
+            }
+            file.data_ = static_cast<const char*>(p);
+        }
+        ::close(fd);  // The mapping keeps its own reference to the file
+        file.advise(pattern);
+#else
+        (void)pattern;
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) return std::unexpected("Cannot open " + path);
+        file.size_ = static_cast<std::size_t>(in.tellg());
+        file.fallback_ = std::make_unique_for_overwrite<char[]>(file.size_);
+        in.seekg(0);
+        in.read(file.fallback_.get(), static_cast<std::streamsize>(file.size_));
+        file.data_ = file.fallback_.get();
+#endif
+        return file;
+    }
+
+    // Change the hint, e.g. before switching from a scan to random lookups
+    void advise([[maybe_unused]] AccessPattern pattern) const {
+#if defined(__unix__) || defined(__APPLE__)
+        if (!data_) return;
+        int advice = MADV_NORMAL;
+        switch (pattern) {
+            case AccessPattern::Normal: advice = MADV_NORMAL; break;
+            case AccessPattern::Sequential: advice = MADV_SEQUENTIAL; break;
+            case AccessPattern::Random: advice = MADV_RANDOM; break;
+            case AccessPattern::WillNeed: advice = MADV_WILLNEED; break;
+        }
+        ::madvise(const_cast<char*>(data_), size_, advice);  // Only a hint: errors are ignored
+#endif
+    }
+
+    std::span<const char> bytes() const { return {data_, size_}; }
+    std::size_t size() const { return size_; }
+    bool empty() const { return size_ == 0; }
+};
+
+// Drop-in FileProcessor (satisfies cpp20_style::Processable) whose buffer
+// is the mapped file itself
+class FileProcessor {
+    std::string filename_;
+    AccessPattern pattern_;
+    MappedFile file_;
+    std::string last_error_;
+
+public:
+    explicit FileProcessor(std::string filename, AccessPattern pattern = AccessPattern::Sequential)
+        : filename_(std::move(filename)), pattern_(pattern) {
+        if (filename_.empty()) {
+            throw std::invalid_argument("Filename cannot be empty");
+        }
+    }
+
+    bool process() {
+        TRACE_SCOPE("mapped FileProcessor::process");
+        auto mapped = MappedFile::open(filename_, pattern_);
+        if (!mapped) {
+            last_error_ = std::move(mapped.error());
+            return false;
+        }
+        file_ = std::move(*mapped);
+        last_error_.clear();
+        return true;
+    }
+
+    const std::string& lastError() const { return last_error_; }
+
+    // Whole file: never truncated
+    size_t getSize() const { return file_.size(); }
+
+    std::span<const char> getBufferSpan() const { return file_.bytes(); }
+
+    std::span<const char> getSubBuffer(size_t offset, size_t length) const {
+        if (offset >= file_.size() || length > file_.size() - offset) {
+            throw std::out_of_range("Invalid buffer range");
+        }
+        return file_.bytes().subspan(offset, length);
+    }
+
+    void advise(AccessPattern pattern) const { file_.advise(pattern); }
+};
+
+static_assert(cpp20_style::Processable<FileProcessor>);
+
+void demo() {
+    std::println("=== Mapped Style: Zero-Copy Files ===\n");
+
+    auto path = (std::filesystem::temp_directory_path() / "example4_mapped.txt").string();
+    {
+        std::ofstream out(path, std::ios::binary);
+        for (int i = 0; i < 10'000; ++i) {
+            out << "record " << i << ": some payload text\n";
+        }
+    }
+
+    // The fixed-size buffer reports the truncation instead of hiding it
+    cpp23_style::FileProcessor buffered(path, 1024);
+    bool complete = buffered.process();
+    std::println("Buffered (1024 bytes): complete = {}, read {} bytes", complete, buffered.getBytesRead());
+
+    FileProcessor mapped(path);
+    if (!mapped.process()) {
+        std::println("Error: {}", mapped.lastError());
+        return;
+    }
+
+    auto bytes = mapped.getBufferSpan();
+    std::println("Mapped: {} bytes, {} lines, no copy",
+                 mapped.getSize(), std::ranges::count(bytes, '\n'));
+
+    auto record = mapped.getSubBuffer(0, 27);
+    std::println("First record: {}", std::string_view(record.data(), record.size()));
+
+    try {
+        mapped.getSubBuffer(mapped.getSize() - 4, 8);
+    } catch (const std::out_of_range& e) {
+        std::println("Out-of-range sub-buffer: {}", e.what());
+    }
+
+    FileProcessor missing("does_not_exist.txt");
+    if (!missing.process()) {
+        std::println("Expected error: {}", missing.lastError());
+    }
+
+    // Read cost for a larger file
+    {
+        std::ofstream out(path, std::ios::binary | std::ios::trunc);
+        std::string line(127, 'x');
+        line += '\n';
+        for (int i = 0; i < 64 * 1024; ++i) out << line;  // 8 MiB
+    }
+    std::size_t file_size = std::filesystem::file_size(path);
+
+    bench::Suite suite("example4.read_file");
+    suite.run("ifstream into make_unique buffer", file_size, [&] {
+        cpp20_style::FileProcessor processor(path, file_size);
+        processor.process();
+        return std::ranges::count(processor.getBufferSpan(), '\n');
+    });
+    suite.run("mmap (sequential hint)", file_size, [&] {
+        FileProcessor processor(path, AccessPattern::Sequential);
+        processor.process();
+        return std::ranges::count(processor.getBufferSpan(), '\n');
+    });
+    suite.report();
+
+    std::filesystem::remove(path);
+    std::println("");
+}
+
+} // namespace mapped_style
+
+// ============================================================================
+// Async Style: Batched processing with bounded reads in flight
+// ============================================================================
+
+namespace async_style {
+
+// DataManager processes its files one blocking read after another. When a
+// job touches thousands of files, the time goes to waiting on each read;
+// keeping several reads in flight overlaps that latency. The engine runs
+// Processable::process() - a blocking call - on a fixed set of worker
+// threads, so the worker count is the number of reads in flight.
+
+using cpp20_style::Processable;
+
+template<Processable P>
+struct Completion {
+    std::size_t id = 0;                       // Order of submission
+    std::unique_ptr<P> resource;              // Ownership returns to the caller
+    std::expected<void, std::string> status;
+    std::chrono::nanoseconds latency{};       // From submit() to completion
+};
+
+template<Processable P>
+class AsyncEngine {
+public:
+    using Callback = std::function<void(Completion<P>)>;
+
+private:
+    using clock = std::chrono::steady_clock;
+
+    struct Job {
+        Completion<P> completion;
+        Callback callback;
+        clock::time_point submitted;
+    };
+
+    std::mutex mutex_;
+    std::condition_variable_any work_ready_;
+    std::condition_variable_any idle_;
+    std::deque<Job> queue_;
+    std::size_t outstanding_ = 0;  // Submitted, callback not yet returned
+    std::size_t next_id_ = 0;
+    std::vector<std::jthread> workers_;  // Last member: joined first on destruction
+
+    std::size_t enqueue(Completion<P> completion, Callback callback) {
+        std::size_t id;
+        {
+            std::lock_guard lock(mutex_);
+            id = completion.id = next_id_++;
+            ++outstanding_;
+            queue_.push_back({std::move(completion), std::move(callback), clock::now()});
+            TRACE_COUNTER("async outstanding", outstanding_);
+        }
+        work_ready_.notify_one();
+        return id;
+    }
+
+    void execute(Job& job) {
+        TRACE_SCOPE("async execute");
+        auto& completion = job.completion;
+        if (completion.resource) {  // Factory errors arrive already failed
+            try {
+                if (!completion.resource->process()) {
+                    completion.status = std::unexpected("process() failed");
+                }
+            } catch (const std::exception& e) {
+                completion.status = std::unexpected(e.what());
+            }
+        }
+        completion.latency = clock::now() - job.submitted;
+
+        // Runs on this worker; a coroutine resumed here may submit again
+        // before outstanding_ drops, so wait() cannot return early
+        if (job.callback) job.callback(std::move(completion));
+
+        std::lock_guard lock(mutex_);
+        if (--outstanding_ == 0) idle_.notify_all();
+    }
+
+    void workerLoop(std::stop_token stop) {
+        while (true) {
+            Job job;
+            {
+                std::unique_lock lock(mutex_);
+                if (!work_ready_.wait(lock, stop, [this] { return !queue_.empty(); })) return;
+                job = std::move(queue_.front());
+                queue_.pop_front();
+            }
+            execute(job);
+        }
+    }
+
+public:
+    explicit AsyncEngine(std::size_t max_in_flight = 16) {
+        if (max_in_flight == 0) {
+            throw std::invalid_argument("max_in_flight must be > 0");
+        }
+        for (std::size_t i = 0; i < max_in_flight; ++i) {
+            workers_.emplace_back([this](std::stop_token stop) { workerLoop(stop); });
+        }
+    }
+
+    AsyncEngine(const AsyncEngine&) = delete;
+    AsyncEngine& operator=(const AsyncEngine&) = delete;
+
+    // Finishes everything already submitted
+    ~AsyncEngine() { wait(); }
+
+    std::size_t maxInFlight() const { return workers_.size(); }
+
+    // on_done runs on a worker thread and must be thread-safe
+    std::size_t submit(std::unique_ptr<P> resource, Callback on_done = {}) {
+        if (!resource) {
+            return enqueue({0, nullptr, std::unexpected("Null resource"), {}}, std::move(on_done));
+        }
+        return enqueue({0, std::move(resource), {}, {}}, std::move(on_done));
+    }
+
+    // Accepts createProcessor() results directly; a creation error is
+    // delivered through on_done like any other failure
+    std::size_t submit(std::expected<std::unique_ptr<P>, std::string> created, Callback on_done = {}) {
+        if (!created) {
+            return enqueue({0, nullptr, std::unexpected(std::move(created.error())), {}},
+                           std::move(on_done));
+        }
+        return submit(std::move(*created), std::move(on_done));
+    }
+
+    // Block until every submitted job's callback has returned
+    void wait() {
+        std::unique_lock lock(mutex_);
+        idle_.wait(lock, [this] { return outstanding_ == 0; });
+    }
+
+    // co_await engine.read(std::move(resource)) - resumes on a worker thread
+    auto read(std::unique_ptr<P> resource) {
+        struct Awaiter {
+            AsyncEngine& engine;
+            std::unique_ptr<P> resource;
+            Completion<P> result;
+
+            bool await_ready() const noexcept { return false; }
+
+            void await_suspend(std::coroutine_handle<> handle) {
+                // May resume the coroutine before submit() returns, so
+                // nothing here touches the awaiter afterwards
+                engine.submit(std::move(resource), [this, handle](Completion<P> completion) {
+                    result = std::move(completion);
+                    handle.resume();
+                });
+            }
+
+            Completion<P> await_resume() { return std::move(result); }
+        };
+        return Awaiter{*this, std::move(resource), {}};
+    }
+};
+
+// Eager, fire-and-forget coroutine. AsyncEngine::wait() covers every read
+// it issues, so it needs no handle of its own.
+struct Detached {
+    struct promise_type {
+        Detached get_return_object() noexcept { return {}; }
+        std::suspend_never initial_suspend() noexcept { return {}; }
+        std::suspend_never final_suspend() noexcept { return {}; }
+        void return_void() noexcept {}
+        void unhandled_exception() noexcept { std::terminate(); }
+    };
+};
+
+// Reads its files one after another; several of these run concurrently
+Detached countBytes(AsyncEngine<cpp23_style::FileProcessor>& engine,
+                    std::span<const std::string> paths, std::size_t buffer_size,
+                    std::atomic<std::size_t>& total) {
+    for (const auto& path : paths) {
+        auto completion = co_await engine.read(
+            std::make_unique<cpp23_style::FileProcessor>(path, buffer_size));
+        if (completion.status) total += completion.resource->getBytesRead();
+    }
+}
+
+void demo() {
+    std::println("=== Async Style: Batched File Processing ===\n");
+
+    constexpr std::size_t file_count = 256;
+    constexpr std::size_t buffer_size = 64 * 1024;
+
+    auto dir = std::filesystem::temp_directory_path() / "example4_async";
+    std::filesystem::create_directories(dir);
+    std::vector<std::string> paths;
+    std::size_t expected_bytes = 0;
+    for (std::size_t i = 0; i < file_count; ++i) {
+        auto path = (dir / std::format("file{}.txt", i)).string();
+        std::ofstream out(path, std::ios::binary);
+        std::string content(1024 * (1 + i % 32), 'a' + static_cast<char>(i % 26));
+        out << content;
+        expected_bytes += content.size();
+        paths.push_back(std::move(path));
+    }
+
+    // Callbacks: submit the whole batch, collect results as they complete
+    {
+        AsyncEngine<cpp23_style::FileProcessor> engine(8);
+        std::mutex results_mutex;
+        std::size_t bytes = 0;
+        std::vector<std::string> errors;
+
+        auto on_done = [&](Completion<cpp23_style::FileProcessor> completion) {
+            std::lock_guard lock(results_mutex);
+            if (completion.status) {
+                bytes += completion.resource->getBytesRead();
+            } else {
+                errors.push_back(std::format("#{}: {}", completion.id, completion.status.error()));
+            }
+        };
+
+        for (const auto& path : paths) {
+            engine.submit(cpp23_style::createProcessor(path, buffer_size), on_done);
+        }
+        engine.submit(cpp23_style::createProcessor("", buffer_size), on_done);
+        engine.submit(cpp23_style::createProcessor((dir / "missing.txt").string(), buffer_size), on_done);
+        engine.wait();
+
+        std::println("Callbacks: {} files, {} bytes (expected {}), {} reads in flight",
+                     file_count, bytes, expected_bytes, engine.maxInFlight());
+        for (const auto& error : errors) std::println("  Error {}", error);
+    }
+
+    // Coroutines: four sequential readers share the engine
+    {
+        AsyncEngine<cpp23_style::FileProcessor> engine(8);
+        std::atomic<std::size_t> total{0};
+        std::span<const std::string> all(paths);
+        std::size_t quarter = all.size() / 4;
+        for (std::size_t i = 0; i < 4; ++i) {
+            countBytes(engine, all.subspan(i * quarter, quarter), buffer_size, total);
+        }
+        engine.wait();
+        std::println("Coroutines: {} bytes", total.load());
+    }
+
+    // Whole-batch cost: blocking loop vs the engine. The files were just
+    // written, so they are in the page cache and the engine can only add
+    // overhead here; it pays off when reads wait on storage or the network.
+    bench::Suite suite("example4.batch_processing");
+    suite.run("sequential process()", file_count, [&] {
+        std::size_t bytes = 0;
+        for (const auto& path : paths) {
+            cpp23_style::FileProcessor processor(path, buffer_size);
+            if (processor.process()) bytes += processor.getBytesRead();
+        }
+        return bytes;
+    });
+    for (std::size_t in_flight : {1, 4, 16}) {
+        AsyncEngine<cpp23_style::FileProcessor> engine(in_flight);
+        suite.run(std::format("AsyncEngine, {} in flight", in_flight), file_count, [&] {
+            std::atomic<std::size_t> bytes{0};
+            for (const auto& path : paths) {
+                engine.submit(std::make_unique<cpp23_style::FileProcessor>(path, buffer_size),
+                              [&](Completion<cpp23_style::FileProcessor> completion) {
+                                  if (completion.status) bytes += completion.resource->getBytesRead();
+                              });
+            }
+            engine.wait();
+            return bytes.load();
+        });
+    }
+    suite.report();
+
+    std::filesystem::remove_all(dir);
+    std::println("");
+}
+
+} // namespace async_style
+
+// ============================================================================
+// Pooled Style: Reusing buffers across short-lived processors
+// ============================================================================
+
+namespace pooled_style {
+
+// Each FileProcessor above allocates its own buffer, and short-lived
+// processors pay for that allocation (plus a memset with make_unique) on
+// every file. A BufferPool keeps released buffers in power-of-two size
+// classes and hands them out again through RAII leases.
+
+class BufferPool {
+public:
+    // Block alignment for O_DIRECT; also satisfies any SIMD load width
+    static constexpr std::size_t alignment = 4096;
+    static constexpr std::size_t min_class_size = 4096;
+    static constexpr std::size_t class_count = 13;  // 4 KiB .. 16 MiB; larger requests bypass the pool
+
+    struct Stats {
+        std::uint64_t hits = 0;     // Leases served from a cached buffer
+        std::uint64_t misses = 0;   // Leases that had to allocate
+        std::size_t cached = 0;     // Buffers currently waiting for reuse
+    };
+
+    // Move-only handle to a pooled buffer; returns it on destruction.
+    // Contents are left as the previous user wrote them.
+    class Lease {
+        BufferPool* pool_ = nullptr;
+        char* data_ = nullptr;
+        std::size_t size_ = 0;       // Requested size
+        std::size_t capacity_ = 0;   // Size of the underlying block
+
+        friend class BufferPool;
+        Lease(BufferPool* pool, char* data, std::size_t size, std::size_t capacity)
+            : pool_(pool), data_(data), size_(size), capacity_(capacity) {}
+
+    public:
+        Lease() = default;
+
+        Lease(Lease&& other) noexcept
+            : pool_(std::exchange(other.pool_, nullptr)),
+              data_(std::exchange(other.data_, nullptr)),
+              size_(std::exchange(other.size_, 0)),
+              capacity_(std::exchange(other.capacity_, 0)) {}
+
+        Lease& operator=(Lease&& other) noexcept {
+            if (this != &other) {
+                reset();
+                pool_ = std::exchange(other.pool_, nullptr);
+                data_ = std::exchange(other.data_, nullptr);
+                size_ = std::exchange(other.size_, 0);
+                capacity_ = std::exchange(other.capacity_, 0);
+            }
+            return *this;
+        }
+
+        ~Lease() { reset(); }
+
+        void reset() noexcept {
+            if (data_) pool_->release(data_, capacity_);
+            data_ = nullptr;
+            size_ = capacity_ = 0;
+        }
+
+        char* data() const { return data_; }
+        std::size_t size() const { return size_; }
+        std::size_t capacity() const { return capacity_; }
+        std::span<char> span() const { return {data_, size_}; }
+        explicit operator bool() const { return data_ != nullptr; }
+    };
+
+private:
+    struct SizeClass {
+        std::mutex mutex;
+        std::vector<char*> free;
+    };
+
+    std::array<SizeClass, class_count> classes_;
+    std::size_t max_cached_per_class_;
+    std::atomic<std::uint64_t> hits_{0};
+    std::atomic<std::uint64_t> misses_{0};
+
+    static std::size_t classIndex(std::size_t capacity) {
+        return static_cast<std::size_t>(std::countr_zero(capacity / min_class_size));
+    }
+
+    static char* allocateBlock(std::size_t capacity) {
+        return static_cast<char*>(::operator new(capacity, std::align_val_t{alignment}));
+    }
+
+    static void freeBlock(char* block) noexcept {
+        ::operator delete(block, std::align_val_t{alignment});
+    }
+
+    void release(char* block, std::size_t capacity) noexcept {
+        if (capacity <= min_class_size << (class_count - 1)) {
+            auto& size_class = classes_[classIndex(capacity)];
+            std::lock_guard lock(size_class.mutex);
+            if (size_class.free.size() < max_cached_per_class_) {
+                size_class.free.push_back(block);  // Pre-reserved: cannot throw
+                return;
+            }
+        }
+        freeBlock(block);
+    }
+
+public:
+    explicit BufferPool(std::size_t max_cached_per_class = 64)
+        : max_cached_per_class_(max_cached_per_class) {
+        for (auto& size_class : classes_) size_class.free.reserve(max_cached_per_class_);
+    }
+
+    BufferPool(const BufferPool&) = delete;
+    BufferPool& operator=(const BufferPool&) = delete;
+
+    // Every lease must be returned first
+    ~BufferPool() {
+        for (auto& size_class : classes_) {
+            for (char* block : size_class.free) freeBlock(block);
+        }
+    }
+
+    // Process-wide pool for callers that do not manage their own
+    static BufferPool& shared() {
+        static BufferPool pool;
+        return pool;
+    }
+
+    Lease acquire(std::size_t size) {
+        std::size_t capacity = std::bit_ceil(std::max(size, min_class_size));
+        if (capacity <= min_class_size << (class_count - 1)) {
+            auto& size_class = classes_[classIndex(capacity)];
+            std::lock_guard lock(size_class.mutex);
+            if (!size_class.free.empty()) {
+                char* block = size_class.free.back();
+                size_class.free.pop_back();
+                hits_.fetch_add(1, std::memory_order_relaxed);
+                return Lease(this, block, size, capacity);
+            }
+        }
+        misses_.fetch_add(1, std::memory_order_relaxed);
+        return Lease(this, allocateBlock(capacity), size, capacity);
+    }
+
+    Stats stats() {
+        Stats stats{hits_.load(std::memory_order_relaxed), misses_.load(std::memory_order_relaxed), 0};
+        for (auto& size_class : classes_) {
+            std::lock_guard lock(size_class.mutex);
+            stats.cached += size_class.free.size();
+        }
+        return stats;
+    }
+};
+
+// FileProcessor whose buffer is leased from a pool; move-only, so it also
+// works with cpp20_style::ResourceGuard
+class FileProcessor {
+    BufferPool::Lease buffer_;
+    std::string filename_;
+    size_t bytes_read_ = 0;
+
+public:
+    FileProcessor(const std::string& filename, size_t buffer_size,
+                  BufferPool& pool = BufferPool::shared())
+        : filename_(filename) {
+        if (buffer_size == 0) {
+            throw std::invalid_argument("Buffer size must be > 0");
+        }
+        if (filename.empty()) {
+            throw std::invalid_argument("Filename cannot be empty");
+        }
+        buffer_ = pool.acquire(buffer_size);
+    }
+
+    FileProcessor(FileProcessor&&) = default;
+    FileProcessor& operator=(FileProcessor&&) = default;
+
+    // Fails rather than silently truncating a file larger than the buffer
+    bool process() {
+        TRACE_SCOPE("pooled FileProcessor::process");
+        std::ifstream file(filename_, std::ios::binary);
+        if (!file) return false;
+        file.read(buffer_.data(), static_cast<std::streamsize>(buffer_.size()));
+        bytes_read_ = static_cast<size_t>(file.gcount());
+        return file.peek() == std::ifstream::traits_type::eof();
+    }
+
+    size_t getSize() const { return buffer_.size(); }
+    size_t getBytesRead() const { return bytes_read_; }
+
+    // Only the bytes read are meaningful: a reused buffer is not cleared
+    std::span<const char> getData() const { return buffer_.span().first(bytes_read_); }
+
+    std::span<char> getBufferSpan() { return buffer_.span(); }
+    std::span<const char> getBufferSpan() const { return buffer_.span(); }
+};
+
+static_assert(cpp20_style::Processable<FileProcessor>);
+static_assert(cpp20_style::UniqueResource<FileProcessor>);
+
+void demo() {
+    std::println("=== Pooled Style: Buffer Pool ===\n");
+
+    BufferPool pool;
+
+    {
+        auto lease = pool.acquire(10'000);
+        std::println("Lease: {} bytes requested, {} byte block, {}-byte aligned: {}",
+                     lease.size(), lease.capacity(), BufferPool::alignment,
+                     reinterpret_cast<std::uintptr_t>(lease.data()) % BufferPool::alignment == 0);
+    }  // Returned to its size class here
+
+    auto path = (std::filesystem::temp_directory_path() / "example4_pooled.txt").string();
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << "pooled buffers are reused across processors\n";
+    }
+
+    // Short-lived processors: only the first one allocates
+    for (int i = 0; i < 100; ++i) {
+        cpp20_style::ResourceGuard guard(std::make_unique<FileProcessor>(path, 16 * 1024, pool));
+        guard->process();
+    }
+    auto stats = pool.stats();
+    std::println("100 processors: {} hits, {} misses, {} cached buffers",
+                 stats.hits, stats.misses, stats.cached);
+
+    FileProcessor processor(path, 1024, pool);
+    processor.process();
+    auto data = processor.getData();
+    std::print("Data: {}", std::string_view(data.data(), data.size()));
+
+    // Shared across threads
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&pool, &path] {
+                for (int i = 0; i < 1000; ++i) {
+                    FileProcessor worker(path, 64 * 1024, pool);
+                    bench::doNotOptimize(worker.getBufferSpan().data());
+                }
+            });
+        }
+    }
+    stats = pool.stats();
+    std::println("After 4 threads x 1000 leases: {} hits, {} misses", stats.hits, stats.misses);
+
+    bench::Suite suite("example4.processor_buffers");
+    for (std::size_t size : {4'096uz, 65'536uz, 1'048'576uz}) {
+        suite.run("cpp23 FileProcessor (make_unique)", size, [&] {
+            cpp23_style::FileProcessor p(path, size);
+            return p.process();
+        });
+        suite.run("pooled FileProcessor", size, [&] {
+            FileProcessor p(path, size, pool);
+            return p.process();
+        });
+    }
+    suite.report();
+
+    std::filesystem::remove(path);
+    std::println("");
+}
+
+} // namespace pooled_style
+
+// ============================================================================
+// Streaming Style: Chunked reads and zero-copy lines
+// ============================================================================
+
+namespace streaming_style {
+
+// FileProcessor holds a whole file in one buffer, and FileHandle::readLine
+// copies every line into a std::string. ChunkedReader instead walks the
+// file in fixed-size chunks through two pooled buffers: a background
+// thread fills one while the caller works on the other.
+
+class ChunkedReader {
+    std::ifstream file_;
+    std::string filename_;
+    std::array<pooled_style::BufferPool::Lease, 2> buffers_;
+    std::array<std::size_t, 2> lengths_{};
+    std::string error_;              // Written before the final chunk; read only after it
+    std::counting_semaphore<> free_{2};  // Buffers the reader thread may fill
+    std::counting_semaphore<> full_{0};  // Buffers ready for the caller
+    std::atomic<bool> stopping_{false};
+    std::size_t current_ = 0;        // Buffer the caller holds (or will take next)
+    bool holding_ = false;
+    bool finished_ = false;
+    std::jthread prefetcher_;        // Last member: joined first on destruction
+
+    void prefetch() {
+        for (std::size_t slot = 0;; slot ^= 1) {
+            free_.acquire();
+            if (stopping_.load(std::memory_order_relaxed)) return;
+
+            auto& buffer = buffers_[slot];
+            {
+                TRACE_SCOPE("chunked prefetch read");
+                file_.read(buffer.data(), static_cast<std::streamsize>(buffer.size()));
+            }
+            lengths_[slot] = static_cast<std::size_t>(file_.gcount());
+            if (file_.bad()) error_ = "Read error in " + filename_;
+
+            bool last = lengths_[slot] == 0 || !error_.empty();
+            if (last) lengths_[slot] = 0;  // An empty chunk marks the end
+            full_.release();
+            if (last) return;
+        }
+    }
+
+public:
+    ChunkedReader(const std::string& filename, std::size_t chunk_size,
+                  pooled_style::BufferPool& pool = pooled_style::BufferPool::shared())
+        : file_(filename, std::ios::binary), filename_(filename) {
+        if (chunk_size == 0) {
+            throw std::invalid_argument("Chunk size must be > 0");
+        }
+        if (!file_.is_open()) {
+            throw std::runtime_error("Failed to open: " + filename);
+        }
+        for (auto& buffer : buffers_) buffer = pool.acquire(chunk_size);
+        prefetcher_ = std::jthread([this] { prefetch(); });
+    }
+
+    // The reader thread points into this object
+    ChunkedReader(const ChunkedReader&) = delete;
+    ChunkedReader& operator=(const ChunkedReader&) = delete;
+
+    ~ChunkedReader() {
+        stopping_ = true;
+        free_.release();  // Wake the reader thread if it waits for a buffer
+    }
+
+    // Next chunk, or nullopt at end of file. The previous chunk's bytes
+    // stay valid until this is called again. Throws once on a read error.
+    std::optional<std::span<const char>> next() {
+        if (finished_) return std::nullopt;
+        if (holding_) {
+            free_.release();  // Hand the previous buffer back for prefetching
+            current_ ^= 1;
+        }
+        full_.acquire();
+        holding_ = true;
+
+        if (lengths_[current_] != 0) {
+            return buffers_[current_].span().first(lengths_[current_]);
+        }
+        // Only the final chunk may carry the error: the reader thread wrote
+        // error_ before releasing it and has stopped since
+        finished_ = true;
+        if (!error_.empty()) throw std::runtime_error(error_);
+        return std::nullopt;
+    }
+
+    // Input range over the chunks: for (std::span<const char> chunk : reader.chunks())
+    class Chunks : public std::ranges::view_interface<Chunks> {
+        ChunkedReader* reader_ = nullptr;
+        std::optional<std::span<const char>> chunk_;
+
+    public:
+        class iterator {
+            Chunks* chunks_ = nullptr;
+
+        public:
+            using value_type = std::span<const char>;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            explicit iterator(Chunks* chunks) : chunks_(chunks) {}
+
+            std::span<const char> operator*() const { return *chunks_->chunk_; }
+            iterator& operator++() { chunks_->chunk_ = chunks_->reader_->next(); return *this; }
+            void operator++(int) { ++*this; }
+            bool operator==(std::default_sentinel_t) const { return !chunks_->chunk_; }
+        };
+
+        Chunks() = default;
+        explicit Chunks(ChunkedReader& reader) : reader_(&reader) {}
+
+        iterator begin() { chunk_ = reader_->next(); return iterator(this); }
+        std::default_sentinel_t end() const { return std::default_sentinel; }
+    };
+
+    // Input range of lines without their '\n'. Each string_view points into
+    // the current chunk; only a line that crosses a chunk boundary is
+    // copied, into a buffer reused from line to line. A view is valid until
+    // the iterator advances.
+    class Lines : public std::ranges::view_interface<Lines> {
+        ChunkedReader* reader_ = nullptr;
+        std::span<const char> rest_;   // Unconsumed part of the current chunk
+        std::string carry_;            // Start of a line split across chunks
+        std::string_view line_;
+        bool stitched_ = false;        // line_ points into carry_
+        bool done_ = false;
+
+        void advance() {
+            if (std::exchange(stitched_, false)) carry_.clear();
+            while (true) {
+                // memchr is vectorized in every mainstream libc
+                const char* pos = rest_.empty() ? nullptr
+                    : static_cast<const char*>(std::memchr(rest_.data(), '\n', rest_.size()));
+                if (pos) {
+                    auto length = static_cast<std::size_t>(pos - rest_.data());
+                    if (carry_.empty()) {
+                        line_ = std::string_view(rest_.data(), length);
+                    } else {
+                        carry_.append(rest_.data(), length);
+                        line_ = carry_;
+                        stitched_ = true;
+                    }
+                    rest_ = rest_.subspan(length + 1);
+                    return;
+                }
+
+                // No newline left: keep the partial line before the chunk is recycled
+                if (!rest_.empty()) carry_.append(rest_.data(), rest_.size());
+                auto chunk = reader_->next();
+                if (!chunk) {
+                    rest_ = {};
+                    if (carry_.empty()) {
+                        done_ = true;
+                    } else {
+                        line_ = carry_;  // Final line without '\n'
+                        stitched_ = true;
+                    }
+                    return;
+                }
+                rest_ = *chunk;
+            }
+        }
+
+    public:
+        class iterator {
+            Lines* lines_ = nullptr;
+
+        public:
+            using value_type = std::string_view;
+            using difference_type = std::ptrdiff_t;
+
+            iterator() = default;
+            explicit iterator(Lines* lines) : lines_(lines) {}
+
+            std::string_view operator*() const { return lines_->line_; }
+            iterator& operator++() { lines_->advance(); return *this; }
+            void operator++(int) { ++*this; }
+            bool operator==(std::default_sentinel_t) const { return lines_->done_; }
+        };
+
+        Lines() = default;
+        explicit Lines(ChunkedReader& reader) : reader_(&reader) {}
+
+        iterator begin() { advance(); return iterator(this); }
+        std::default_sentinel_t end() const { return std::default_sentinel; }
+    };
+
+    Chunks chunks() { return Chunks(*this); }
+    Lines lines() { return Lines(*this); }
+};
+
+static_assert(std::ranges::input_range<ChunkedReader::Chunks>);
+static_assert(std::ranges::view<ChunkedReader::Lines>);
+
+void demo() {
+    std::println("=== Streaming Style: Chunked Reader ===\n");
+
+    auto path = (std::filesystem::temp_directory_path() / "example4_streaming.txt").string();
+    std::size_t expected_lines = 50'000;
+    {
+        std::ofstream out(path, std::ios::binary);
+        for (std::size_t i = 0; i < expected_lines; ++i) {
+            out << "line " << i << ' ' << std::string(i % 97, '.') << '\n';
+        }
+        out << std::string(10'000, '#') << '\n';  // Longer than a chunk
+        out << "last line, no newline";
+        expected_lines += 2;
+    }
+
+    // Much smaller than the file: nothing is truncated
+    ChunkedReader chunked(path, 4096);
+    std::size_t chunk_count = 0, bytes = 0;
+    for (std::span<const char> chunk : chunked.chunks()) {
+        ++chunk_count;
+        bytes += chunk.size();
+    }
+    std::println("Chunks: {} x 4096 bytes, {} bytes total (file: {})",
+                 chunk_count, bytes, std::filesystem::file_size(path));
+
+    ChunkedReader reader(path, 4096);
+    std::size_t line_count = 0, longest = 0;
+    std::string last;
+    for (std::string_view line : reader.lines()) {
+        ++line_count;
+        longest = std::max(longest, line.size());
+        last.assign(line);  // The view itself dies with the next line
+    }
+    std::println("Lines: {} (expected {}), longest {} bytes, last \"{}\"",
+                 line_count, expected_lines, longest, last);
+
+    // Composes with range adaptors
+    ChunkedReader filtered(path, 64 * 1024);
+    auto with_nine = std::ranges::distance(
+        filtered.lines() | std::views::filter([](std::string_view line) {
+            return line.starts_with("line 9");
+        }));
+    std::println("Lines starting with \"line 9\": {}", with_nine);
+
+    try {
+        ChunkedReader missing("does_not_exist.txt", 4096);
+    } catch (const std::runtime_error& e) {
+        std::println("Expected error: {}", e.what());
+    }
+
+    std::size_t file_size = std::filesystem::file_size(path);
+    bench::Suite suite("example4.line_iteration");
+    suite.run("FileHandle::readLine (getline)", file_size, [&] {
+        cpp14_style::FileHandle handle(path);
+        std::string line;
+        std::size_t total = 0;
+        while (handle.readLine(line)) total += line.size();
+        return total;
+    });
+    for (std::size_t chunk_size : {4'096uz, 65'536uz}) {
+        suite.run(std::format("ChunkedReader::lines, {} byte chunks", chunk_size), file_size, [&] {
+            ChunkedReader stream(path, chunk_size);
+            std::size_t total = 0;
+            for (std::string_view line : stream.lines()) total += line.size();
+            return total;
+        });
+    }
+    suite.report();
+
+    std::filesystem::remove(path);
+    std::println("");
+}
+
+} // namespace streaming_style
+
+// ============================================================================
+// Traced Style: Scoped timers and resource lifetimes
+// ============================================================================
+
+namespace traced_style {
+
+// The processors above carry TRACE_SCOPE timers (src/trace.hpp), as do the
+// async workers and the chunked reader's prefetch thread. They record only
+// when built with -DTRACE_ENABLED=1; otherwise the macros expand to nothing
+// and the code compiles as if they were not there.
+//
+// trace::Tracked is cpp20_style::ResourceGuard plus accounting: the
+// resource's lifetime becomes one event carrying its size, and a
+// "tracked bytes" counter follows the total held by live guards.
+
+void demo() {
+    std::println("=== Traced Style: Scoped Timers and Resource Lifetimes ===\n");
+
+    if constexpr (!trace::enabled) {
+        std::println("Tracing is compiled out; rebuild with -DTRACE_ENABLED=1 to record events\n");
+    }
+
+    auto path = (std::filesystem::temp_directory_path() / "example4_traced.txt").string();
+    {
+        std::ofstream out(path, std::ios::binary);
+        out << std::string(64 * 1024, 't');
+    }
+
+    for (std::size_t size : {4'096uz, 65'536uz, 1'048'576uz}) {
+        trace::Tracked guard("cpp20 FileProcessor lifetime",
+                             std::make_unique<cpp20_style::FileProcessor>(path, size), size);
+        bool complete = guard->process();
+        std::println("{:>8}-byte buffer: {} bytes read{}", size, guard->getBytesRead(),
+                     complete ? "" : " (truncated)");
+    }
+
+    // Each worker records into its own ring buffer, without locking
+    {
+        std::vector<std::jthread> threads;
+        for (int t = 0; t < 4; ++t) {
+            threads.emplace_back([&path] {
+                for (int i = 0; i < 250; ++i) {
+                    cpp23_style::FileProcessor processor(path, 64 * 1024);
+                    processor.process();
+                }
+            });
+        }
+    }
+
+    if constexpr (trace::enabled) {
+        std::ostringstream json;
+        trace::writeChromeTrace(json);
+        std::println("Chrome trace so far: {} KiB (TRACE_JSON=<file> saves it at exit)",
+                     json.str().size() / 1024);
+    }
+
+    // The cost of one timer: two clock reads and a store into the ring, or
+    // nothing at all when compiled out. Measured on its own thread so the
+    // probe events do not overwrite the ones above in this thread's ring
+    // (the probe takes over the ring of the thread that exited first).
+    std::jthread([] {
+        bench::Suite suite("example4.trace_overhead");
+        suite.run("empty loop body", 1, [] {});
+        suite.run("TRACE_SCOPE", 1, [] { TRACE_SCOPE("overhead probe"); });
+        suite.run("TRACE_COUNTER", 1, [] { TRACE_COUNTER("overhead probe", 1); });
+        suite.report();
+    }).join();
+
+    std::filesystem::remove(path);
+    std::println("");
+}
+
+} // namespace traced_style
+
 // ============================================================================
 // Comparison: Exception Safety
 // ============================================================================
@@ -535,21 +1708,115 @@ void exception_safety_demo() {
 // Performance Comparison
 // ============================================================================
 
+// Each "zero-overhead" claim, measured: buffer ownership, buffer access,
+// error reporting and transfer of ownership
+
+// Plain pointer + length loop, the baseline for the span versions
+long long sumBytes(const char* data, std::size_t size) {
+    long long total = 0;
+    for (std::size_t i = 0; i < size; ++i) total += data[i];
+    return total;
+}
+
+long long sumBytes(std::span<const char> data) {
+    long long total = 0;
+    for (char c : data) total += c;
+    return total;
+}
+
 void performance_demo() {
     std::println("=== Performance Comparison ===\n");
 
-    std::println("Zero-overhead principle maintained:");
-    std::println("  - Smart pointers: No runtime cost vs raw pointers");
-    std::println("  - std::span: Zero-cost abstraction");
-    std::println("  - Concepts: Zero runtime cost (compile-time only)");
-    std::println("  - std::expected: No heap allocation");
-    std::println("  - Move semantics: Eliminates unnecessary copies");
+    bench::Suite ownership("example4.buffer_ownership");
+    bench::Suite access("example4.buffer_access");
+
+    for (std::size_t size : {64uz, 4'096uz, 1'048'576uz}) {
+        ownership.run("new[] / delete[]", size, [size] {
+            char* buffer = new char[size];
+            bench::doNotOptimize(buffer);
+            delete[] buffer;
+        });
+        // make_unique value-initializes: the buffer is zero-filled
+        ownership.run("make_unique<char[]>", size, [size] {
+            auto buffer = std::make_unique<char[]>(size);
+            bench::doNotOptimize(buffer.get());
+        });
+        ownership.run("make_unique_for_overwrite", size, [size] {
+            auto buffer = std::make_unique_for_overwrite<char[]>(size);
+            bench::doNotOptimize(buffer.get());
+        });
+        ownership.run("BufferPool lease", size, [size] {
+            auto buffer = pooled_style::BufferPool::shared().acquire(size);
+            bench::doNotOptimize(buffer.data());
+        });
+
+        cpp20_style::FileProcessor processor("data.txt", size);
+        auto span = processor.getBufferSpan();
+        std::ranges::fill(span, '\1');
+        const char* raw = span.data();
+
+        access.run("raw pointer + size", size, [&] { return sumBytes(raw, size); });
+        access.run("std::span", size, [&] { return sumBytes(span); });
+        access.run("std::span subspan halves", size, [&] {
+            return sumBytes(span.first(size / 2)) + sumBytes(span.subspan(size / 2));
+        });
+    }
+
+    bench::Suite errors("example4.error_reporting");
+
+    errors.run("expected: success", 1, [] {
+        return cpp23_style::createProcessor("data.txt", 1024).has_value();
+    });
+    errors.run("expected: error value", 1, [] {
+        return cpp23_style::createProcessor("", 1024).has_value();
+    });
+    errors.run("exception: success", 1, [] {
+        return std::make_unique<cpp23_style::FileProcessor>("data.txt", 1024) != nullptr;
+    });
+    errors.run("exception: throw + catch", 1, [] {
+        try {
+            return std::make_unique<cpp23_style::FileProcessor>("", 1024) != nullptr;
+        } catch (const std::invalid_argument&) {
+            return false;
+        }
+    });
+
+    bench::Suite transfer("example4.ownership_transfer");
+
+    for (std::size_t size : {16uz, 1'024uz}) {
+        std::vector<std::string> names(size, std::string(32, 'x'));
+        transfer.run("copy vector<string>", size, [&] {
+            auto copy = names;
+            return copy.size();
+        });
+        transfer.run("move vector<string> (and back)", size, [&] {
+            auto moved = std::move(names);
+            auto n = moved.size();
+            names = std::move(moved);
+            return n;
+        });
+    }
+    transfer.run("make + move unique_ptr<FileProcessor>", 1, [] {
+        auto original = std::make_unique<cpp14_style::FileProcessor>("move.txt", 256);
+        auto moved = std::move(original);
+        return moved->getSize();
+    });
+
+    ownership.report();
+    std::println("");
+    access.report();
+    std::println("");
+    errors.report();
+    std::println("");
+    transfer.report();
 
-    std::println("\nActually faster in practice:");
-    std::println("  - RAII enables more optimizations");
-    std::println("  - Move semantics reduces overhead");
-    std::println("  - Compiler can optimize unique_ptr better");
-    std::println("  - No need for try/catch everywhere");
+    // What the numbers show:
+    // - unique_ptr adds no cost over new/delete; make_unique's zero-fill
+    //   does, which make_unique_for_overwrite avoids
+    // - std::span compiles to the same loop as pointer + size
+    // - std::expected never allocates for itself, but a std::string error
+    //   longer than the small-string buffer does
+    // - Moving a vector is O(1) with no allocation; copying is O(n) allocations
 
     std::println("");
 }
@@ -563,8 +1830,14 @@ int main() {
     cpp14_style::demo();
     cpp20_style::demo();
     cpp23_style::demo();
+    mapped_style::demo();
+    async_style::demo();
+    pooled_style::demo();
+    streaming_style::demo();
+    traced_style::demo();
     exception_safety_demo();
     performance_demo();
 
+    trace::report();
     return 0;
 }
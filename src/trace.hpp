@@ -0,0 +1,360 @@
+/**
+ * Hot-path tracing for the examples, compiled in only on request.
+ *
+ * Build with -DTRACE_ENABLED=1 to record events. Otherwise the TRACE_SCOPE
+ * and TRACE_COUNTER macros expand to nothing, arguments included, and the
+ * instrumented code compiles exactly as if they were not there.
+ *
+ * Usage:
+ *   double evaluate(const Expr& expr) {
+ *       TRACE_SCOPE("evaluate");                 // Timed until end of scope
+ *       TRACE_COUNTER("nodes", countNodes(expr));
+ *       ...
+ *   }
+ *
+ *   trace::Tracked guard("file buffer", std::move(processor), bytes);
+ *                                               // Lifetime and bytes
+ *
+ *   trace::writeChromeTrace("trace.json");      // chrome://tracing, Perfetto
+ *   trace::printSummary();                      // Count/total/mean/max per name
+ *   trace::report();                            // Both; used at the end of main()
+ *
+ * Each thread records into its own fixed-size ring buffer, so recording
+ * never takes a lock; once a ring is full the oldest events are
+ * overwritten and reported as dropped. A ring holds 64 Ki events (2.5 MiB)
+ * and is handed to a new thread once its owner exits, keeping the old
+ * events until they are overwritten; memory grows with the number of
+ * threads traced at the same time, not with thread churn. Names must be
+ * string literals (or otherwise outlive the export). Export while traced
+ * threads are idle.
+ *
+ * report() prints the summary and writes the Chrome trace to the file named
+ * by the TRACE_JSON environment variable, if set; each example calls it on
+ * exit.
+ *
+ * The macros wrap trace::Scope and trace::counter, which can also be used
+ * directly; when disabled they are empty, but a call to trace::counter
+ * still evaluates its arguments.
+ */
+
+#pragma once
+
+#ifndef TRACE_ENABLED
+#define TRACE_ENABLED 0
+#endif
+
+#include <algorithm>
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <cstddef>
+#include <cstdint>
+#include <cstdlib>
+#include <format>
+#include <fstream>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <ostream>
+#include <print>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#define TRACE_CONCAT_IMPL(a, b) a##b
+#define TRACE_CONCAT(a, b) TRACE_CONCAT_IMPL(a, b)
+
+#if TRACE_ENABLED
+#define TRACE_SCOPE(name) ::trace::Scope TRACE_CONCAT(trace_scope_, __LINE__)(name)
+#define TRACE_COUNTER(name, value) ::trace::counter((name), static_cast<std::int64_t>(value))
+#else
+#define TRACE_SCOPE(name) static_cast<void>(0)
+#define TRACE_COUNTER(name, value) static_cast<void>(0)
+#endif
+
+namespace trace {
+
+inline constexpr bool enabled = TRACE_ENABLED != 0;
+
+#if TRACE_ENABLED
+
+namespace detail {
+
+enum class Kind : std::uint8_t { Complete, Counter };
+
+struct Event {
+    const char* name;
+    std::int64_t start_ns;     // steady_clock time since its epoch
+    std::int64_t duration_ns;
+    std::int64_t value;  // Counter value, or bytes of a tracked resource
+    Kind kind;
+    std::uint32_t thread_id = 0;  // Set by ThreadBuffer::push
+};
+
+// Only the owning thread writes; `head` counts every event ever written
+struct ThreadBuffer {
+    static constexpr std::size_t capacity = std::size_t{1} << 16;
+
+    std::array<Event, capacity> events;
+    std::atomic<std::uint64_t> head{0};
+    std::uint32_t thread_id = 0;         // Current owner
+    ThreadBuffer* next_idle = nullptr;   // Registry::idle list, while unowned
+
+    void push(Event event) {
+        event.thread_id = thread_id;
+        std::uint64_t n = head.load(std::memory_order_relaxed);
+        events[n % capacity] = event;
+        head.store(n + 1, std::memory_order_release);
+    }
+};
+
+// Buffers outlive their threads so the trace can be exported afterwards;
+// those of exited threads are reused. The mutex is only taken when a
+// thread records its first event and when it exits.
+struct Registry {
+    std::mutex mutex;
+    std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+    ThreadBuffer* idle = nullptr;       // Longest idle first, so the oldest
+    ThreadBuffer* idle_tail = nullptr;  // events are overwritten first
+    std::uint32_t next_thread_id = 1;
+};
+
+inline Registry& registry() {
+    static Registry instance;
+    return instance;
+}
+
+// A thread's claim on a buffer, returned to the idle list at thread exit
+class ThreadSlot {
+    ThreadBuffer* buffer_;
+
+public:
+    ThreadSlot() {
+        auto& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        if (reg.idle) {
+            buffer_ = std::exchange(reg.idle, reg.idle->next_idle);
+            if (!reg.idle) reg.idle_tail = nullptr;
+        } else {
+            buffer_ = reg.buffers.emplace_back(std::make_unique<ThreadBuffer>()).get();
+        }
+        buffer_->thread_id = reg.next_thread_id++;
+    }
+
+    ~ThreadSlot() {
+        auto& reg = registry();
+        std::lock_guard lock(reg.mutex);
+        buffer_->next_idle = nullptr;
+        (reg.idle_tail ? reg.idle_tail->next_idle : reg.idle) = buffer_;
+        reg.idle_tail = buffer_;
+    }
+
+    ThreadSlot(const ThreadSlot&) = delete;
+    ThreadSlot& operator=(const ThreadSlot&) = delete;
+
+    ThreadBuffer& buffer() { return *buffer_; }
+};
+
+inline ThreadBuffer& threadBuffer() {
+    thread_local ThreadSlot slot;
+    return slot.buffer();
+}
+
+inline std::int64_t now() {
+    return std::chrono::duration_cast<std::chrono::nanoseconds>(
+        std::chrono::steady_clock::now().time_since_epoch()).count();
+}
+
+// Exported timestamps are relative to program start
+inline const std::int64_t start_time = now();
+
+inline std::atomic<std::int64_t> tracked_bytes{0};
+
+inline std::string jsonEscape(std::string_view s) {
+    std::string out;
+    for (char c : s) {
+        if (c == '"' || c == '\\') out += '\\';
+        out += c;
+    }
+    return out;
+}
+
+} // namespace detail
+
+// Records the time from construction to destruction as one event
+class Scope {
+    const char* name_;
+    std::int64_t start_;
+
+public:
+    explicit Scope(const char* name) : name_(name), start_(detail::now()) {}
+
+    ~Scope() {
+        detail::threadBuffer().push({name_, start_, detail::now() - start_, 0, detail::Kind::Complete});
+    }
+
+    Scope(const Scope&) = delete;
+    Scope& operator=(const Scope&) = delete;
+};
+
+// Records a sampled value, drawn as a counter track
+inline void counter(const char* name, std::int64_t value) {
+    detail::threadBuffer().push({name, detail::now(), 0, value, detail::Kind::Counter});
+}
+
+// Like cpp20_style::ResourceGuard, plus a lifetime event carrying the
+// resource's size and a running "tracked bytes" counter
+template<typename T>
+class Tracked {
+    std::unique_ptr<T> resource_;
+    const char* name_;
+    std::int64_t bytes_;
+    std::int64_t start_;
+
+public:
+    Tracked(const char* name, std::unique_ptr<T> resource, std::size_t bytes)
+        : resource_(std::move(resource)), name_(name),
+          bytes_(static_cast<std::int64_t>(bytes)), start_(detail::now()) {
+        counter("tracked bytes", detail::tracked_bytes += bytes_);
+    }
+
+    ~Tracked() {
+        detail::threadBuffer().push({name_, start_, detail::now() - start_, bytes_, detail::Kind::Complete});
+        counter("tracked bytes", detail::tracked_bytes -= bytes_);
+    }
+
+    Tracked(const Tracked&) = delete;
+    Tracked& operator=(const Tracked&) = delete;
+
+    T* operator->() { return resource_.get(); }
+    const T* operator->() const { return resource_.get(); }
+    T& get() { return *resource_; }
+    const T& get() const { return *resource_; }
+};
+
+// Calls fn(thread_id, event) for every event still held, oldest first per
+// buffer, and returns how many were overwritten before they could be read
+template<typename Fn>
+std::uint64_t forEachEvent(Fn&& fn) {
+    auto& reg = detail::registry();
+    std::lock_guard lock(reg.mutex);
+    std::uint64_t dropped = 0;
+    for (const auto& buffer : reg.buffers) {
+        std::uint64_t head = buffer->head.load(std::memory_order_acquire);
+        std::uint64_t first = head > detail::ThreadBuffer::capacity ? head - detail::ThreadBuffer::capacity : 0;
+        dropped += first;
+        for (std::uint64_t i = first; i < head; ++i) {
+            const auto& event = buffer->events[i % detail::ThreadBuffer::capacity];
+            fn(event.thread_id, event);
+        }
+    }
+    return dropped;
+}
+
+// Chrome trace event format (JSON object form), timestamps in microseconds
+inline void writeChromeTrace(std::ostream& out) {
+    out << "{\"traceEvents\":[\n";
+    bool first = true;
+    auto dropped = forEachEvent([&](std::uint32_t tid, const detail::Event& e) {
+        out << (first ? "" : ",\n");
+        first = false;
+        auto name = detail::jsonEscape(e.name);
+        if (e.kind == detail::Kind::Counter) {
+            out << std::format("{{\"name\":\"{}\",\"ph\":\"C\",\"ts\":{:.3f},\"pid\":1,\"tid\":{},"
+                               "\"args\":{{\"value\":{}}}}}",
+                               name, (e.start_ns - detail::start_time) / 1e3, tid, e.value);
+        } else {
+            out << std::format("{{\"name\":\"{}\",\"ph\":\"X\",\"ts\":{:.3f},\"dur\":{:.3f},\"pid\":1,\"tid\":{}",
+                               name, (e.start_ns - detail::start_time) / 1e3, e.duration_ns / 1e3, tid);
+            if (e.value) out << std::format(",\"args\":{{\"bytes\":{}}}", e.value);
+            out << "}";
+        }
+    });
+    out << std::format("\n],\"otherData\":{{\"dropped_events\":{}}}}}\n", dropped);
+}
+
+inline bool writeChromeTrace(const std::string& path) {
+    std::ofstream out(path);
+    if (!out) return false;
+    writeChromeTrace(out);
+    return static_cast<bool>(out);
+}
+
+// Per-name totals of the timed events, slowest total first
+inline void printSummary() {
+    struct Totals {
+        std::uint64_t count = 0;
+        std::int64_t total_ns = 0;
+        std::int64_t max_ns = 0;
+    };
+    std::map<std::string_view, Totals> by_name;
+    auto dropped = forEachEvent([&](std::uint32_t, const detail::Event& e) {
+        if (e.kind != detail::Kind::Complete) return;
+        auto& totals = by_name[e.name];
+        ++totals.count;
+        totals.total_ns += e.duration_ns;
+        totals.max_ns = std::max(totals.max_ns, e.duration_ns);
+    });
+
+    std::vector<std::pair<std::string_view, Totals>> rows(by_name.begin(), by_name.end());
+    std::ranges::sort(rows, std::ranges::greater{}, [](const auto& row) { return row.second.total_ns; });
+
+    std::println("{:<40} {:>9} {:>13} {:>11} {:>11}", "trace scope", "count", "total us", "mean us", "max us");
+    for (const auto& [name, totals] : rows) {
+        std::println("  {:<38} {:>9} {:>13.1f} {:>11.2f} {:>11.2f}", name, totals.count,
+                     totals.total_ns / 1e3, totals.total_ns / 1e3 / static_cast<double>(totals.count),
+                     totals.max_ns / 1e3);
+    }
+    if (dropped) std::println("  ({} older events overwritten)", dropped);
+}
+
+#else // !TRACE_ENABLED
+
+// Disabled: the same interface, with nothing behind it
+
+class Scope {
+public:
+    constexpr explicit Scope(const char*) {}
+    constexpr ~Scope() {}  // User-provided, so an unused `scope` does not warn
+};
+
+constexpr void counter(const char*, std::int64_t) {}
+
+template<typename T>
+class Tracked {
+    std::unique_ptr<T> resource_;
+
+public:
+    Tracked(const char*, std::unique_ptr<T> resource, std::size_t)
+        : resource_(std::move(resource)) {}
+
+    T* operator->() { return resource_.get(); }
+    const T* operator->() const { return resource_.get(); }
+    T& get() { return *resource_; }
+    const T& get() const { return *resource_; }
+};
+
+inline void writeChromeTrace(std::ostream&) {}
+inline bool writeChromeTrace(const std::string&) { return false; }
+inline void printSummary() {}
+
+#endif // TRACE_ENABLED
+
+// Print the summary and, when TRACE_JSON names a file, write the Chrome
+// trace to it. Does nothing unless tracing is compiled in.
+inline void report() {
+    if constexpr (enabled) {
+        std::println("");
+        printSummary();
+        if (const char* path = std::getenv("TRACE_JSON")) {
+            if (writeChromeTrace(std::string(path))) {
+                std::println("Trace written to {}", path);
+            } else {
+                std::println("Could not write trace to {}", path);
+            }
+        }
+    }
+}
+
+} // namespace trace